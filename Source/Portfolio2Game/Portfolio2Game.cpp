@@ -2,8 +2,71 @@
 
 #include "Portfolio2Game.h"
 #include "Modules/ModuleManager.h"
+#include "HAL/IConsoleManager.h"
+#include "BattleAllocTracker.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, Portfolio2Game, "Portfolio2Game" );
+class FPortfolio2GameModule : public FDefaultGameModuleImpl
+{
+public:
+	virtual void StartupModule() override
+	{
+		// 할당 카운팅 프록시는 게임플레이가 시작되기 전 여기서만 설치 (-BattleAllocTrack)
+		FBattleAllocTracker::InstallAtStartup();
+	}
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FPortfolio2GameModule, Portfolio2Game, "Portfolio2Game" );
 
 DEFINE_LOG_CATEGORY(LogPortfolio2Game)
- 
\ No newline at end of file
+DEFINE_LOG_CATEGORY(LogBattle)
+
+#if !(NO_LOGGING || UE_BUILD_SHIPPING)
+namespace BattleLog
+{
+	// 추적 대상 이름 목록 (액터 이름 또는 클래스 이름)
+	static TSet<FName> TracedUnitNames;
+
+	bool IsUnitTraced(const UObject* Unit)
+	{
+		// 대부분의 경우 비어 있으므로 여기서 바로 빠짐
+		if (TracedUnitNames.Num() == 0 || !Unit)
+		{
+			return false;
+		}
+
+		return TracedUnitNames.Contains(Unit->GetFName())
+			|| TracedUnitNames.Contains(Unit->GetClass()->GetFName());
+	}
+
+	static FAutoConsoleCommand TraceUnitCmd(
+		TEXT("Battle.Log.Trace"),
+		TEXT("지정한 유닛(액터 이름 또는 클래스 이름)의 전투 추적 로그를 Log 레벨로 출력합니다. 예) Battle.Log.Trace BP_Slime_C_0"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			for (const FString& Arg : Args)
+			{
+				TracedUnitNames.Add(FName(*Arg));
+				UE_LOG(LogBattle, Log, TEXT("[BattleLog] Trace On: %s"), *Arg);
+			}
+		}));
+
+	static FAutoConsoleCommand UntraceUnitCmd(
+		TEXT("Battle.Log.Untrace"),
+		TEXT("지정한 유닛의 전투 추적 로그를 끕니다. 인자가 없으면 전부 끕니다."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			if (Args.Num() == 0)
+			{
+				TracedUnitNames.Empty();
+				UE_LOG(LogBattle, Log, TEXT("[BattleLog] Trace Cleared"));
+				return;
+			}
+
+			for (const FString& Arg : Args)
+			{
+				TracedUnitNames.Remove(FName(*Arg));
+				UE_LOG(LogBattle, Log, TEXT("[BattleLog] Trace Off: %s"), *Arg);
+			}
+		}));
+}
+#endif
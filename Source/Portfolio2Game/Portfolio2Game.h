@@ -5,3 +5,37 @@
 #include "CoreMinimal.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogPortfolio2Game, Log, All);
+
+// 전투 흐름(턴/이동/스킬/예약/AI/라운드) 전용 로그 카테고리
+// - 행동 단위 추적은 Verbose/VeryVerbose로 남기고, Shipping에서는 Warning 이하만 컴파일됩니다.
+#if UE_BUILD_SHIPPING
+DECLARE_LOG_CATEGORY_EXTERN(LogBattle, Log, Warning);
+#else
+DECLARE_LOG_CATEGORY_EXTERN(LogBattle, Log, All);
+#endif
+
+// ───────── 유닛별 추적 로그 ─────────
+// 평소에는 지정한 Verbosity로 기록되고(기본 설정이면 출력 안 됨),
+// 콘솔 "Battle.Log.Trace <이름>"으로 지정한 유닛만 Log 레벨로 올려서 출력합니다.
+// 이름은 액터 이름(BP_Slime_C_0) 또는 클래스 이름(BP_Slime_C) 모두 허용합니다.
+#if NO_LOGGING || UE_BUILD_SHIPPING
+#define UE_LOG_BATTLE_UNIT(Unit, Verbosity, Format, ...) do {} while (0)
+#else
+namespace BattleLog
+{
+	PORTFOLIO2GAME_API bool IsUnitTraced(const UObject* Unit);
+}
+
+#define UE_LOG_BATTLE_UNIT(Unit, Verbosity, Format, ...) \
+	do \
+	{ \
+		if (BattleLog::IsUnitTraced(Unit)) \
+		{ \
+			UE_LOG(LogBattle, Log, Format, ##__VA_ARGS__); \
+		} \
+		else \
+		{ \
+			UE_LOG(LogBattle, Verbosity, Format, ##__VA_ARGS__); \
+		} \
+	} while (0)
+#endif
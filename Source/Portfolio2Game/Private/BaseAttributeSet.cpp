@@ -22,7 +22,7 @@ void UBaseAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallba
 		// 1. (★수정★) HP가 MaxHP를 넘지 않도록 Clamp (내부 함수 사용)
 		SetHealth_Internal(FMath::Min(GetHP(), GetMaxHP()));
 
-		// 2. 델리게이트 방송! (BP_HPBarActor가 들을 수 있도록 int32로 형변환)
-		OwnerChar->OnHealthChanged.Broadcast(FMath::RoundToInt(GetHP()), FMath::RoundToInt(GetMaxHP()));
+		// 2. 체력 변경 알림 (네이티브 처리 + 이벤트 버스 + BP_HPBarActor용 델리게이트)
+		OwnerChar->NotifyHealthChanged(FMath::RoundToInt(GetHP()), FMath::RoundToInt(GetMaxHP()));
 	}
 }
\ No newline at end of file
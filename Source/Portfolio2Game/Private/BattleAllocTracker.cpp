@@ -0,0 +1,236 @@
+﻿#include "BattleAllocTracker.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Portfolio2Game.h"
+#include "CombatEventBusSubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+namespace BattleAllocTrackerPrivate
+{
+	// 보관할 턴 기록 개수 (오래된 것부터 버림)
+	constexpr int32 MaxHistory = 64;
+
+	struct FTurnAllocRecord
+	{
+		int32 Turn = 0;
+		bool bPlayerTurn = false;
+		uint64 Allocs = 0;
+		uint64 Bytes = 0;
+	};
+
+	// 카운터는 게임 스레드에서만 쓰므로 원자 연산 불필요
+	static bool bCounting = false;
+	static uint64 TurnAllocs = 0;
+	static uint64 TurnBytes = 0;
+
+	static bool bTurnOpen = false;
+	static FTurnAllocRecord CurrentTurn;
+	static TArray<FTurnAllocRecord> History;
+
+	FORCEINLINE void Count(SIZE_T Size)
+	{
+		if (bCounting && IsInGameThread())
+		{
+			TurnAllocs++;
+			TurnBytes += Size;
+		}
+	}
+
+	// 기존 GMalloc을 감싸서 할당만 세고 나머지는 그대로 전달
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInner) : Inner(InInner) {}
+
+		virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+		{
+			Count(Size);
+			return Inner->Malloc(Size, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Size, uint32 Alignment) override
+		{
+			Count(Size);
+			return Inner->TryMalloc(Size, Alignment);
+		}
+
+		virtual void* MallocZeroed(SIZE_T Size, uint32 Alignment) override
+		{
+			Count(Size);
+			return Inner->MallocZeroed(Size, Alignment);
+		}
+
+		virtual void* TryMallocZeroed(SIZE_T Size, uint32 Alignment) override
+		{
+			Count(Size);
+			return Inner->TryMallocZeroed(Size, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Size, uint32 Alignment) override
+		{
+			if (Size > 0) Count(Size); // 0이면 해제
+			return Inner->Realloc(Original, Size, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Size, uint32 Alignment) override
+		{
+			if (Size > 0) Count(Size);
+			return Inner->TryRealloc(Original, Size, Alignment);
+		}
+
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+		virtual void UpdateStats() override { Inner->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+	private:
+		FMalloc* Inner;
+	};
+
+	static FCountingMalloc* CountingMalloc = nullptr;
+
+	static void CloseTurn()
+	{
+		if (!bTurnOpen) return;
+		bTurnOpen = false;
+
+		CurrentTurn.Allocs = TurnAllocs;
+		CurrentTurn.Bytes = TurnBytes;
+
+		UE_LOG(LogBattle, Log, TEXT("[Alloc] Turn %d %s: %llu heap alloc(s), %llu bytes"),
+			CurrentTurn.Turn, CurrentTurn.bPlayerTurn ? TEXT("Player") : TEXT("Enemy"), CurrentTurn.Allocs, CurrentTurn.Bytes);
+
+		if (History.Num() >= MaxHistory)
+		{
+			History.RemoveAt(0);
+		}
+		History.Add(CurrentTurn);
+	}
+}
+
+void FBattleAllocTracker::InstallAtStartup()
+{
+	using namespace BattleAllocTrackerPrivate;
+	check(IsInGameThread());
+
+	if (CountingMalloc || !GMalloc || !FParse::Param(FCommandLine::Get(), TEXT("BattleAllocTrack")))
+	{
+		return;
+	}
+
+	// 게임 모듈 로드 시점 한 번만 교체 (월드/게임플레이 시작 전). 설치 전에 받은 메모리도 Free는 그대로 Inner로 감
+	FCountingMalloc* Proxy = new FCountingMalloc(GMalloc);
+	FPlatformMisc::MemoryBarrier();
+	GMalloc = Proxy;
+	CountingMalloc = Proxy;
+
+	bCounting = true;
+	UE_LOG(LogBattle, Log, TEXT("[Alloc] Counting proxy installed (-BattleAllocTrack), tracking On"));
+}
+
+bool FBattleAllocTracker::IsTracking()
+{
+	return BattleAllocTrackerPrivate::bCounting;
+}
+
+void FBattleAllocTracker::SetTracking(bool bEnable)
+{
+	using namespace BattleAllocTrackerPrivate;
+	check(IsInGameThread());
+
+	if (bEnable && !CountingMalloc)
+	{
+		UE_LOG(LogBattle, Warning, TEXT("[Alloc] No counting proxy. Launch with -BattleAllocTrack to track heap allocations."));
+	}
+	else if (!bEnable)
+	{
+		CloseTurn();
+	}
+
+	// 다음 턴 경계부터 집계
+	bCounting = bEnable && CountingMalloc != nullptr;
+}
+
+void FBattleAllocTracker::BeginTurn(int32 Turn, bool bPlayerTurn)
+{
+	using namespace BattleAllocTrackerPrivate;
+	if (!bCounting) return;
+
+	CloseTurn();
+
+	CurrentTurn = FTurnAllocRecord();
+	CurrentTurn.Turn = Turn;
+	CurrentTurn.bPlayerTurn = bPlayerTurn;
+	TurnAllocs = 0;
+	TurnBytes = 0;
+	bTurnOpen = true;
+}
+
+void FBattleAllocTracker::EndTurn()
+{
+	BattleAllocTrackerPrivate::CloseTurn();
+}
+
+void FBattleAllocTracker::BindCombatEvents(UCombatEventBusSubsystem& Bus)
+{
+	// TurnStart의 Source가 있으면 플레이어 턴
+	Bus.OnEvent(ECombatEventType::TurnStart).AddLambda([](const FCombatEvent& Event)
+	{
+		BeginTurn(Event.Value, Event.Source != nullptr);
+	});
+}
+
+void FBattleAllocTracker::Dump(FOutputDevice& Ar)
+{
+	using namespace BattleAllocTrackerPrivate;
+
+	uint64 Total = 0;
+	for (const FTurnAllocRecord& R : History)
+	{
+		Total += R.Allocs;
+	}
+
+	Ar.Logf(TEXT("===== Battle Turn Allocations (%s, %d turn(s), Avg %.1f) ====="),
+		bCounting ? TEXT("Tracking") : TEXT("Stopped"), History.Num(), History.Num() > 0 ? (double)Total / History.Num() : 0.0);
+	for (const FTurnAllocRecord& R : History)
+	{
+		Ar.Logf(TEXT("Turn %4d %-6s  Allocs %6llu  Bytes %8llu"),
+			R.Turn, R.bPlayerTurn ? TEXT("Player") : TEXT("Enemy"), R.Allocs, R.Bytes);
+	}
+}
+
+// ───────── 콘솔 명령 ─────────
+
+static FAutoConsoleCommand BattleAllocTrackCmd(
+	TEXT("Battle.Alloc.Track"),
+	TEXT("턴 단위 힙 할당 집계를 켜거나(1) 끕니다(0). 실행 인자 -BattleAllocTrack으로 프록시를 설치해 둔 경우에만 동작합니다."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const bool bEnable = (Args.Num() == 0) || FCString::ToBool(*Args[0]);
+		FBattleAllocTracker::SetTracking(bEnable);
+		UE_LOG(LogBattle, Log, TEXT("[Alloc] Tracking %s"), FBattleAllocTracker::IsTracking() ? TEXT("On") : TEXT("Off"));
+	}));
+
+static FAutoConsoleCommand BattleAllocDumpCmd(
+	TEXT("Battle.Alloc.Dump"),
+	TEXT("최근 턴별 힙 할당 기록을 출력합니다."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		FBattleAllocTracker::Dump(Ar);
+	}));
+
+#endif
@@ -0,0 +1,250 @@
+﻿#include "BattleGCSubsystem.h"
+#include "Portfolio2Game.h"
+#include "GridMotionSubsystem.h"
+#include "PortfolioGameInstance.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace BattleGCPrivate
+{
+	static TAutoConsoleVariable<bool> CVarEnable(
+		TEXT("Battle.GC.Policy"),
+		true,
+		TEXT("행동 재생 중에는 GC를 미루고 한가한 구간에 몰아서 실행합니다. 끄면 엔진 기본 주기만 사용합니다."));
+
+	static TAutoConsoleVariable<float> CVarIdleCollectAfterSec(
+		TEXT("Battle.GC.IdleCollectAfterSec"),
+		20.0f,
+		TEXT("마지막 GC 후 이 시간(초)이 지났으면 한가한 구간에 GC를 미리 실행합니다."));
+
+	static TAutoConsoleVariable<float> CVarMaxDeferSec(
+		TEXT("Battle.GC.MaxDeferSec"),
+		90.0f,
+		TEXT("마지막 GC 후 이 시간(초)이 지나면 행동 중이어도 더 이상 GC를 미루지 않습니다."));
+
+	static TAutoConsoleVariable<float> CVarMaxActionSec(
+		TEXT("Battle.GC.MaxActionSec"),
+		5.0f,
+		TEXT("EndAction이 오지 않은 행동을 재생 중으로 간주할 최대 시간(초)."));
+
+	static TAutoConsoleVariable<float> CVarPurgeBudgetMs(
+		TEXT("Battle.GC.PurgeBudgetMs"),
+		2.0f,
+		TEXT("한가한 구간에서 한 프레임에 쓸 증분 Purge 예산(ms)."));
+
+	static UBattleGCSubsystem* GetSubsystem(const UObject* WorldContextObject)
+	{
+		UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+		return World ? World->GetSubsystem<UBattleGCSubsystem>() : nullptr;
+	}
+}
+
+void UBattleGCSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LastGCEndTime = FPlatformTime::Seconds();
+	++GetStats().NumWorlds;
+	PreGCHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &UBattleGCSubsystem::HandlePreGC);
+	PostGCHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UBattleGCSubsystem::HandlePostGC);
+}
+
+void UBattleGCSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGCHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGCHandle);
+
+	Super::Deinitialize();
+}
+
+// ───────── 행동 재생 구간 ─────────
+
+void UBattleGCSubsystem::BeginActionPlayback(const AActor* Actor)
+{
+	if (UBattleGCSubsystem* GC = BattleGCPrivate::GetSubsystem(Actor))
+	{
+		// EndAction이 누락돼도 무한히 막지 않도록 상한 시각으로 등록
+		GC->ActivePlayback.Add(Actor, FPlatformTime::Seconds() + BattleGCPrivate::CVarMaxActionSec.GetValueOnGameThread());
+	}
+}
+
+void UBattleGCSubsystem::EndActionPlayback(const AActor* Actor, float HoldSeconds)
+{
+	if (UBattleGCSubsystem* GC = BattleGCPrivate::GetSubsystem(Actor))
+	{
+		GC->ActivePlayback.Add(Actor, FPlatformTime::Seconds() + FMath::Max(HoldSeconds, 0.0f));
+	}
+}
+
+bool UBattleGCSubsystem::IsActionPlaying() const
+{
+	const UGridMotionSubsystem* Motion = GetWorld() ? GetWorld()->GetSubsystem<UGridMotionSubsystem>() : nullptr;
+	if (Motion && Motion->GetNumActiveMoves() > 0)
+	{
+		return true;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	for (const TPair<TWeakObjectPtr<const AActor>, double>& Pair : ActivePlayback)
+	{
+		if (Pair.Value > Now && Pair.Key.IsValid())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// ───────── 스케줄링 ─────────
+
+void UBattleGCSubsystem::Tick(float DeltaTime)
+{
+	if (!BattleGCPrivate::CVarEnable.GetValueOnGameThread() || !GEngine)
+	{
+		return;
+	}
+
+	// 끝난 항목 정리 (유닛 수만큼이라 매 프레임 순회해도 충분)
+	const double Now = FPlatformTime::Seconds();
+	for (auto It = ActivePlayback.CreateIterator(); It; ++It)
+	{
+		if (It.Value() <= Now || !It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	const double SinceLastGC = Now - LastGCEndTime;
+
+	if (IsActionPlaying())
+	{
+		// 이번 프레임의 주기 GC / 증분 Purge를 미룸 (너무 오래 밀렸으면 엔진에 맡김)
+		if (SinceLastGC < BattleGCPrivate::CVarMaxDeferSec.GetValueOnGameThread())
+		{
+			GEngine->DelayGarbageCollection();
+			++GetStats().NumDeferredFrames;
+		}
+		return;
+	}
+
+	// 한가한 구간: 밀린 Purge부터 예산 안에서 처리
+	if (IsIncrementalPurgePending())
+	{
+		const double BudgetSec = BattleGCPrivate::CVarPurgeBudgetMs.GetValueOnGameThread() / 1000.0;
+		const double SliceStart = FPlatformTime::Seconds();
+		IncrementalPurgeGarbage(true, BudgetSec);
+		FBattleGCStats& Stats = GetStats();
+		Stats.PurgeSliceMs += (FPlatformTime::Seconds() - SliceStart) * 1000.0;
+		++Stats.NumPurgeSlices;
+		return;
+	}
+
+	// 다음 주기 GC가 행동 중에 걸리지 않도록 지금 당겨서 실행 (다음 프레임 엔진 Tick에서 수행)
+	if (!bIdleCollectRequested && SinceLastGC >= BattleGCPrivate::CVarIdleCollectAfterSec.GetValueOnGameThread())
+	{
+		GEngine->ForceGarbageCollection(false);
+		bIdleCollectRequested = true;
+		++GetStats().NumIdleCollects;
+	}
+}
+
+TStatId UBattleGCSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBattleGCSubsystem, STATGROUP_Tickables);
+}
+
+// ───────── 통계 ─────────
+
+FBattleGCStats& UBattleGCSubsystem::GetStats()
+{
+	UPortfolioGameInstance* GI = GetWorld() ? Cast<UPortfolioGameInstance>(GetWorld()->GetGameInstance()) : nullptr;
+	return GI ? GI->GetBattleGCStats() : LocalStats;
+}
+
+const FBattleGCStats& UBattleGCSubsystem::GetStats() const
+{
+	return const_cast<UBattleGCSubsystem*>(this)->GetStats();
+}
+
+void UBattleGCSubsystem::HandlePreGC()
+{
+	GCStartTime = FPlatformTime::Seconds();
+	bGCStartedInAction = IsActionPlaying();
+	bGCStartedWithPolicy = BattleGCPrivate::CVarEnable.GetValueOnGameThread();
+}
+
+void UBattleGCSubsystem::HandlePostGC()
+{
+	const double Now = FPlatformTime::Seconds();
+	const double Ms = (Now - GCStartTime) * 1000.0;
+
+	FBattleGCStats::FGCPauseStats& Stats = GetStats().PauseStats[bGCStartedWithPolicy ? 1 : 0];
+	++Stats.NumPauses;
+	Stats.TotalMs += Ms;
+	Stats.MaxMs = FMath::Max(Stats.MaxMs, Ms);
+	if (bGCStartedInAction)
+	{
+		++Stats.NumInAction;
+		Stats.InActionMs += Ms;
+		UE_LOG(LogBattle, Verbose, TEXT("[GC] %.2f ms pause landed during action playback (Policy: %s)"),
+			Ms, bGCStartedWithPolicy ? TEXT("ON") : TEXT("OFF"));
+	}
+
+	LastGCEndTime = Now;
+	bIdleCollectRequested = false;
+}
+
+void UBattleGCSubsystem::DumpStats(FOutputDevice& Ar) const
+{
+	const FBattleGCStats& Totals = GetStats();
+	Ar.Logf(TEXT("===== Battle GC (%d stage(s), now %s) ====="), Totals.NumWorlds, *GetWorld()->GetMapName());
+
+	static const TCHAR* PolicyNames[] = { TEXT("Policy OFF"), TEXT("Policy ON ") };
+	for (int32 i = 0; i < 2; ++i)
+	{
+		const FBattleGCStats::FGCPauseStats& Stats = Totals.PauseStats[i];
+		Ar.Logf(TEXT("%s | Pauses %4d | InAction %4d (%5.1f%%) | Avg %6.2f ms | Max %6.2f ms | InAction total %8.2f ms"),
+			PolicyNames[i], Stats.NumPauses, Stats.NumInAction,
+			Stats.NumPauses > 0 ? 100.0 * Stats.NumInAction / Stats.NumPauses : 0.0,
+			Stats.NumPauses > 0 ? Stats.TotalMs / Stats.NumPauses : 0.0,
+			Stats.MaxMs, Stats.InActionMs);
+	}
+
+	Ar.Logf(TEXT("Deferred frames %d | Idle collects %d | Idle purge slices %d (%.2f ms) | Since last GC %.1f s"),
+		Totals.NumDeferredFrames, Totals.NumIdleCollects, Totals.NumPurgeSlices, Totals.PurgeSliceMs, FPlatformTime::Seconds() - LastGCEndTime);
+}
+
+void UBattleGCSubsystem::ResetStats()
+{
+	// 현재 월드부터 다시 집계
+	FBattleGCStats& Stats = GetStats();
+	Stats.Reset();
+	Stats.NumWorlds = 1;
+}
+
+// ───────── 콘솔 명령 ─────────
+
+static FAutoConsoleCommand BattleGCDumpCmd(
+	TEXT("Battle.GC.Dump"),
+	TEXT("GC 정지가 행동 재생 중에 걸린 횟수를 정책 ON/OFF별로 출력합니다."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		if (UBattleGCSubsystem* GC = World ? World->GetSubsystem<UBattleGCSubsystem>() : nullptr)
+		{
+			GC->DumpStats(Ar);
+		}
+	}));
+
+static FAutoConsoleCommand BattleGCResetCmd(
+	TEXT("Battle.GC.Reset"),
+	TEXT("전투 GC 통계를 초기화합니다."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UBattleGCSubsystem* GC = World ? World->GetSubsystem<UBattleGCSubsystem>() : nullptr)
+		{
+			GC->ResetStats();
+		}
+	}));
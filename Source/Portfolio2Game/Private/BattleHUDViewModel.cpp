@@ -0,0 +1,124 @@
+﻿#include "BattleHUDViewModel.h"
+#include "PortfolioGameInstance.h"
+#include "PlayerSkillData.h"
+#include "PlayerCharacter.h"
+#include "CombatEventBusSubsystem.h"
+#include "Kismet/GameplayStatics.h"
+
+UBattleHUDViewModel* UBattleHUDViewModel::Get(const UObject* WorldContextObject)
+{
+	const UPortfolioGameInstance* GI = Cast<UPortfolioGameInstance>(UGameplayStatics::GetGameInstance(WorldContextObject));
+	return GI ? GI->GetBattleHUDViewModel() : nullptr;
+}
+
+void UBattleHUDViewModel::SetTurn(int32 InTurn)
+{
+	if (Turn == InTurn) return;
+	Turn = InTurn;
+	NotifyField(EBattleHUDField::Turn);
+}
+
+void UBattleHUDViewModel::SetRound(int32 InRound)
+{
+	if (Round == InRound) return;
+	Round = InRound;
+	NotifyField(EBattleHUDField::Round);
+}
+
+void UBattleHUDViewModel::SetEnemyCounts(int32 InAlive, int32 InRemaining)
+{
+	if (AliveEnemies == InAlive && RemainingEnemies == InRemaining) return;
+	AliveEnemies = InAlive;
+	RemainingEnemies = InRemaining;
+	NotifyField(EBattleHUDField::EnemyCount);
+}
+
+void UBattleHUDViewModel::SetPlayerHealth(int32 InHP, int32 InMaxHP)
+{
+	if (PlayerHP == InHP && PlayerMaxHP == InMaxHP) return;
+	PlayerHP = InHP;
+	PlayerMaxHP = InMaxHP;
+	NotifyField(EBattleHUDField::PlayerHealth);
+}
+
+void UBattleHUDViewModel::SetSkillCooldowns(const TArray<FPlayerSkillData>& Skills)
+{
+	bool bChanged = false;
+
+	// 스킬 획득/초기화로 개수가 바뀌면 전체 갱신
+	if (Cooldowns.Num() != Skills.Num())
+	{
+		Cooldowns.SetNumZeroed(Skills.Num());
+		bChanged = true;
+	}
+
+	for (int32 i = 0; i < Skills.Num(); ++i)
+	{
+		if (Cooldowns[i] == Skills[i].CurrentCooldown) continue;
+
+		Cooldowns[i] = Skills[i].CurrentCooldown;
+		OnCooldownChanged.Broadcast(i, Cooldowns[i]);
+		bChanged = true;
+	}
+
+	if (bChanged)
+	{
+		NotifyField(EBattleHUDField::Cooldowns);
+	}
+}
+
+void UBattleHUDViewModel::SetSkillQueue(const TArray<int32>& QueueIndices)
+{
+	if (SkillQueue == QueueIndices) return;
+	SkillQueue = QueueIndices;
+	NotifyField(EBattleHUDField::SkillQueue);
+}
+
+void UBattleHUDViewModel::SetPlayTime(float TotalSeconds)
+{
+	const int32 Seconds = FMath::FloorToInt(TotalSeconds);
+	if (PlayTimeSeconds == Seconds) return;
+	PlayTimeSeconds = Seconds;
+	NotifyField(EBattleHUDField::PlayTime);
+}
+
+void UBattleHUDViewModel::SetStageDisplayName(FName StageName)
+{
+	if (CachedStageName == StageName && !StageDisplayName.IsEmpty()) return;
+	CachedStageName = StageName;
+	StageDisplayName = StageName.IsNone() ? FText::FromString(TEXT("Unknown Area")) : FText::FromName(StageName);
+	NotifyField(EBattleHUDField::StageName);
+}
+
+void UBattleHUDViewModel::BindCombatEvents(UCombatEventBusSubsystem& Bus)
+{
+	if (BoundBus.Get() == &Bus) return;
+	BoundBus = &Bus;
+
+	// 이전 버스의 구독은 그 버스의 Deinitialize에서 함께 정리됨
+	Bus.OnEvent(ECombatEventType::TurnStart).AddUObject(this, &UBattleHUDViewModel::HandleCombatEvent);
+	Bus.OnEvent(ECombatEventType::RoundStart).AddUObject(this, &UBattleHUDViewModel::HandleCombatEvent);
+	Bus.OnEvent(ECombatEventType::HealthChanged).AddUObject(this, &UBattleHUDViewModel::HandleCombatEvent);
+}
+
+void UBattleHUDViewModel::HandleCombatEvent(const FCombatEvent& Event)
+{
+	switch (Event.Type)
+	{
+	case ECombatEventType::TurnStart:
+		SetTurn(Event.Value);
+		break;
+	case ECombatEventType::RoundStart:
+		SetRound(Event.Value);
+		break;
+	case ECombatEventType::HealthChanged:
+		// 적 체력은 타일 HP바가 담당
+		if (Event.Source && Event.Source->IsA<APlayerCharacter>())
+		{
+			SetPlayerHealth(Event.Value, Event.SubValue);
+		}
+		break;
+	default:
+		break;
+	}
+}
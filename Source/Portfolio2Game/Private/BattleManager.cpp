@@ -1,22 +1,37 @@
 ﻿#include "BattleManager.h"
+#include "Portfolio2Game.h"
+#include "BattlePhaseMonitor.h"
+#include "BattleAllocTracker.h"
 #include "PlayerCharacter.h"
+#include "EnforceManager.h"
 #include "GridISM.h"
+#include "ThreatMapComponent.h"
 #include "EnemyCharacter.h"
 #include "CharacterBase.h"
 #include "GridDataInterface.h"
 #include "TimerManager.h"
 #include "PortfolioGameInstance.h"
+#include "BattleHUDViewModel.h"
+#include "CombatEventBusSubsystem.h"
+#include "BattleWorkSlicerSubsystem.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Camera/CameraActor.h"
 #include "Camera/CameraComponent.h"
 #include "ContentStreaming.h"
 #include "Blueprint/UserWidget.h"
+#include "BattleUILayerSubsystem.h"
+#include "BattleMemoryReport.h"
 #include "Kismet/GameplayStatics.h"
+#include "NiagaraComponent.h"
 #include <Misc/OutputDeviceNull.h>
 
 ABattleManager::ABattleManager()
 {
 	PrimaryActorTick.bCanEverTick = false;
 
+	ThreatMap = CreateDefaultSubobject<UThreatMapComponent>(TEXT("ThreatMap"));
+
 	EnemySpawnIndices = { 25, 26, 27, 28, 29, 30, 31, 32, 33, 34 };
 	PlayerSpawnIndex = 10;
 }
@@ -25,17 +40,27 @@ void ABattleManager::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// 1. 레벨 전환 연출 (기존 코드 유지)
+	// 전투 이벤트 버스 네이티브 구독 (HUD 턴/라운드/체력, 턴 할당 집계)
+	if (UCombatEventBusSubsystem* Bus = UCombatEventBusSubsystem::Get(this))
+	{
+		if (UBattleHUDViewModel* HUD = UBattleHUDViewModel::Get(this))
+		{
+			HUD->BindCombatEvents(*Bus);
+		}
+		FBattleAllocTracker::BindCombatEvents(*Bus);
+	}
+
+	// 1. 레벨 전환 연출 (전환 위젯은 공용 UI 레이어 소유: 이전 레벨에서 덮은 인스턴스가 그대로 이어짐)
 	UPortfolioGameInstance* GI = Cast<UPortfolioGameInstance>(GetGameInstance());
+	UBattleUILayerSubsystem* UILayer = UBattleUILayerSubsystem::Get(this);
 	if (GI && GI->bIsLevelTransitioning)
 	{
 		GI->bIsLevelTransitioning = false;
-		if (TransitionWidgetClass)
+		if (TransitionWidgetClass && UILayer)
 		{
-			CurrentTransitionWidget = CreateWidget<UUserWidget>(GetWorld(), TransitionWidgetClass);
-			if (CurrentTransitionWidget)
+			UILayer->EnsureCovered(TransitionWidgetClass);
+			if (UILayer->IsCovered())
 			{
-				CurrentTransitionWidget->AddToViewport(9999);
 				if (IStreamingManager::Get().IsTextureStreamingEnabled())
 				{
 					IStreamingManager::Get().StreamAllResources(10.0f);
@@ -47,6 +72,9 @@ void ABattleManager::BeginPlay()
 		}
 	}
 
+	// 스테이지 선택 + 비동기 로드 시작 (전환 화면 / 시작 연출 동안 진행)
+	RequestStageLoad();
+
 	// 2. 카메라 설정
 	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
 	if (PC)
@@ -71,63 +99,137 @@ void ABattleManager::BeginPlay()
 	{
 		GridInterface.SetObject(GridActorRef);
 		GridInterface.SetInterface(Cast<IGridDataInterface>(GridActorRef));
+
+		RefreshGridGeometry();
+		if (USceneComponent* GridRoot = GridActorRef->GetRootComponent())
+		{
+			GridRoot->TransformUpdated.AddUObject(this, &ABattleManager::OnGridTransformUpdated);
+		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("GridActorRef is NULL! Camera & Grid Interface setup failed."));
+		UE_LOG(LogBattle, Error, TEXT("GridActorRef is NULL! Camera & Grid Interface setup failed."));
 	}
 
-	// 4. 상단 바 생성
-	if (TopBarWidgetClass)
+	// 4. 상단 바 표시 (처음 한 번만 생성, 이후 레벨은 재사용)
+	if (TopBarWidgetClass && UILayer)
 	{
-		UUserWidget* TopBar = CreateWidget<UUserWidget>(GetWorld(), TopBarWidgetClass);
-		if (TopBar) TopBar->AddToViewport(9000);
+		UILayer->ShowLayer(EBattleUILayer::TopBar, TopBarWidgetClass);
 	}
 }
 
 void ABattleManager::ExecuteUncover()
 {
-	if (CurrentTransitionWidget)
+	// 스테이지 로드가 안 끝났으면 덮은 채로 기다림
+	if (!bStageReady)
 	{
-		FOutputDeviceNull Ar;
-		CurrentTransitionWidget->CallFunctionByNameWithArguments(TEXT("PlayUncover"), Ar, nullptr, true);
+		bUncoverPending = true;
+		return;
+	}
+	bUncoverPending = false;
 
-		FTimerHandle KillHandle;
-		GetWorld()->GetTimerManager().SetTimer(KillHandle, [this]()
-			{
-				if (CurrentTransitionWidget)
-				{
-					CurrentTransitionWidget->RemoveFromParent();
-					CurrentTransitionWidget = nullptr;
-				}
-			}, 2.0f, false);
+	if (UBattleUILayerSubsystem* UILayer = UBattleUILayerSubsystem::Get(this))
+	{
+		UILayer->PlayUncover(2.0f);
 	}
 }
 
-void ABattleManager::BeginBattle()
+void ABattleManager::RequestStageLoad()
 {
-	if (!GridInterface) return;
+	if (StageLoadHandle.IsValid() || bStageReady) return;
 
-	// 1. 스테이지 데이터 선택
+	// 1. 후보 중 하나 선택 (경로만 보므로 후보 에셋은 로드되지 않음)
 	if (PossibleStages.Num() > 0)
 	{
 		int32 RandIdx = FMath::RandRange(0, PossibleStages.Num() - 1);
-		CurrentStageData = PossibleStages[RandIdx];
-		UE_LOG(LogTemp, Warning, TEXT("Selected Stage: %s"), *CurrentStageData->GetName());
+		SelectedStage = PossibleStages[RandIdx];
+	}
+
+	if (SelectedStage.IsNull())
+	{
+		// 로드할 것이 없음 -> 바로 준비 완료 (BeginBattle에서 에러 처리)
+		OnStageAssetsLoaded();
+		return;
 	}
 
+	UE_LOG(LogBattle, Log, TEXT("Selected Stage: %s (async load)"), *SelectedStage.ToString());
+
+	StageLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		SelectedStage.ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &ABattleManager::OnStageDataLoaded),
+		FStreamableManager::AsyncLoadHighPriority);
+}
+
+void ABattleManager::OnStageDataLoaded()
+{
+	BATTLE_LLM_SCOPE(StageData);
+	CurrentStageData = SelectedStage.Get();
 	if (!CurrentStageData)
 	{
-		UE_LOG(LogTemp, Error, TEXT("No Stage Data Selected! Check PossibleStages."));
+		UE_LOG(LogBattle, Error, TEXT("Stage load failed: %s"), *SelectedStage.ToString());
+		OnStageAssetsLoaded();
 		return;
 	}
 
-	TotalEnemiesInStage = 0;
-	for (const FRoundDef& Round : CurrentStageData->Rounds)
+	// 2. 이 스테이지가 쓰는 적 클래스만 로드 (메시/몽타주/스킬/이펙트는 클래스 의존성으로 함께)
+	TArray<FSoftObjectPath> EnemyClassPaths;
+	CurrentStageData->GetRequiredEnemyClasses(EnemyClassPaths);
+
+	// 스테이지 핸들은 적 클래스 핸들로 교체 (스테이지 자체는 CurrentStageData가 붙잡음)
+	StageLoadHandle = EnemyClassPaths.Num() > 0
+		? UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			EnemyClassPaths,
+			FStreamableDelegate::CreateUObject(this, &ABattleManager::OnStageAssetsLoaded),
+			FStreamableManager::AsyncLoadHighPriority)
+		: nullptr;
+
+	if (!StageLoadHandle.IsValid())
 	{
-		// 각 라운드별 등장하는 적의 수를 모두 더함
-		TotalEnemiesInStage += Round.EnemiesToSpawn.Num();
+		OnStageAssetsLoaded();
 	}
+}
+
+void ABattleManager::OnStageAssetsLoaded()
+{
+	if (bStageReady) return;
+	bStageReady = true;
+
+	UE_LOG(LogBattle, Log, TEXT("Stage ready: %s"), *GetNameSafe(CurrentStageData));
+
+	// 로드 중에 들어온 요청 처리
+	if (bUncoverPending)
+	{
+		ExecuteUncover();
+	}
+	if (bBeginBattlePending)
+	{
+		bBeginBattlePending = false;
+		BeginBattle();
+	}
+}
+
+void ABattleManager::BeginBattle()
+{
+	if (!GridInterface) return;
+
+	// 1. 스테이지 데이터는 BeginPlay에서 비동기 로드 중 -> 끝나면 다시 호출됨
+	if (!bStageReady)
+	{
+		bBeginBattlePending = true;
+		RequestStageLoad();
+		return;
+	}
+
+	BATTLE_PHASE_SCOPE(EBattlePhase::LevelTransition, this, CurrentStageData);
+
+	if (!CurrentStageData)
+	{
+		UE_LOG(LogBattle, Error, TEXT("No Stage Data Selected! Check PossibleStages."));
+		return;
+	}
+
+	// 라운드 + 증원 전체 적 수 (컴파일된 플랜에 미리 계산되어 있음)
+	TotalEnemiesInStage = CurrentStageData->GetRuntimePlan().TotalEnemies;
 	MaxKillCount = TotalEnemiesInStage;
 
 	// 2. 초기화
@@ -135,10 +237,22 @@ void ABattleManager::BeginBattle()
 	CurrentRoundIndex = 0;
 	TurnCount = 0;
 	TurnsSinceSingleEnemy = 0;
+	AliveEnemyCount = 0;
+	RoundKillCount = 0;
+	RoundTurnCount = 0;
+	Enemies.Reset();
+	PendingSpawnCells.Reset();
+	BroadcastAliveEnemyCount();
+	PushTurnStateToHUD();
+	UCombatEventBusSubsystem::Publish(this, ECombatEventType::RoundStart, nullptr, nullptr, FIntPoint::ZeroValue, CurrentRound);
+	ThreatMap->ResetThreats();
 
 	SpawnPlayer();
 	//SpawnCurrentRoundEnemies();
 
+	// 시작 연출(카메라 블렌드) 동안 이번 스테이지 적을 미리 만들어 둠
+	PrewarmEnemyPool();
+
 	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
 
 
@@ -177,12 +291,25 @@ void ABattleManager::BeginBattle()
 			true
 		);
 
-		UUserWidget* StartWidget = CreateWidget<UUserWidget>(GetWorld(), BattleStartWidgetClass);
-		if (StartWidget)
+		// *중요: 위젯 BP의 Construct(재사용 시 PlayBattleStart)에서 애니메이션 재생 후
+		// OnAnimationFinished에서 매니저의 OnBattleStartAnimFinished()를 호출해야 함!
+		if (UBattleUILayerSubsystem* UILayer = UBattleUILayerSubsystem::Get(this))
 		{
-			StartWidget->AddToViewport(9999);
-			// *중요: 위젯 BP의 Construct에서 애니메이션 재생 후 
-			// OnAnimationFinished에서 매니저의 OnBattleStartAnimFinished()를 호출해야 함!
+			bool bCreated = false;
+			UUserWidget* StartWidget = UILayer->ShowLayer(EBattleUILayer::BattleStart, BattleStartWidgetClass, &bCreated);
+
+			// 재사용된 인스턴스는 Construct가 다시 돌지 않으므로 연출을 직접 재생
+			FOutputDeviceNull Ar;
+			if (StartWidget && !bCreated && !StartWidget->CallFunctionByNameWithArguments(TEXT("PlayBattleStart"), Ar, nullptr, true))
+			{
+				// PlayBattleStart가 없는 위젯은 새로 만들어 Construct로 재생 (기존 방식)
+				UILayer->ResetLayer(EBattleUILayer::BattleStart);
+				UILayer->ShowLayer(EBattleUILayer::BattleStart, BattleStartWidgetClass);
+			}
+		}
+		else
+		{
+			OnBattleStartAnimFinished();
 		}
 	}
 	else
@@ -227,11 +354,19 @@ void ABattleManager::StartActualBattle()
 	// 적 스폰
 	SpawnCurrentRoundEnemies();
 
-	// 플레이어 턴 시작
+	// 플레이어 턴 시작 (스폰이 여러 프레임에 걸치면 끝난 뒤 입력 허용)
 	if (PlayerRef)
 	{
 		CurrentState = EBattleState::PlayerTurn;
-		PlayerRef->StartAction();
+
+		TWeakObjectPtr<ABattleManager> WeakThis(this);
+		RunSliced(TEXT("BattleStart"), 0, nullptr, [WeakThis]()
+		{
+			if (WeakThis.IsValid() && WeakThis->PlayerRef)
+			{
+				WeakThis->PlayerRef->StartAction();
+			}
+		});
 	}
 }
 
@@ -243,37 +378,313 @@ void ABattleManager::OnBattleStartAnimFinished()
 
 void ABattleManager::SpawnCurrentRoundEnemies()
 {
-	if (!CurrentStageData) return;
-	if (!CurrentStageData->Rounds.IsValidIndex(CurrentRoundIndex)) return;
+	const FCompiledRound* Round = GetCurrentCompiledRound();
+	if (!Round) return;
 
-	const FRoundDef& RoundInfo = CurrentStageData->Rounds[CurrentRoundIndex];
+	BATTLE_PHASE_SCOPE(EBattlePhase::RoundSpawn, this, CurrentStageData);
 
-	UE_LOG(LogTemp, Warning, TEXT("=== Spawning Round %d Enemies (%d mobs) ==="),
-		CurrentRoundIndex + 1, RoundInfo.EnemiesToSpawn.Num());
+	// 라운드 진행 카운터 초기화
+	RoundKillCount = 0;
+	RoundTurnCount = 0;
+	FiredWaves.Init(false, Round->Waves.Num());
 
-	TArray<int32> ValidIndices = EnemySpawnIndices;
+	UE_LOG(LogBattle, Log, TEXT("=== Spawning Round %d Enemies (%d waves) ==="),
+		CurrentRoundIndex + 1, Round->Waves.Num());
 
-	// 이미 있는 적 위치는 제외
-	for (AEnemyCharacter* Enemy : Enemies)
+	SpawnGroup(Round->GroupIndex);
+}
+
+void ABattleManager::SpawnGroup(int32 GroupIndex)
+{
+	const FStageRuntimePlan& Plan = CurrentStageData->GetRuntimePlan();
+	if (!Plan.Groups.IsValidIndex(GroupIndex) || !GridGeometry.IsValid()) return;
+
+	const FCompiledSpawnGroup& Group = Plan.Groups[GroupIndex];
+
+	// 앞서 예약된(아직 스폰 대기 중인) 칸도 점유로 취급
+	auto IsFreeCell = [this](int32 Index)
+	{
+		return GridGeometry.IsValidIndex(Index) && GetCharacterAt(GridGeometry.IndexToCoord(Index)) == nullptr
+			&& !PendingSpawnCells.Contains(Index);
+	};
+
+	// 랜덤 후보 (빈 칸만, 한 번만 만들고 뽑을 때마다 RemoveAtSwap)
+	// Fixed 배치에서 지정 칸이 막혔을 때도 기본 후보에서 뽑음
+	const TArray<int32>& CandidateSource = (Group.Rule == ESpawnCellRule::RandomFromList) ? Group.Cells : EnemySpawnIndices;
+	TArray<int32, TInlineAllocator<16>> FreeCells;
+	for (int32 Index : CandidateSource)
+	{
+		if (IsFreeCell(Index)) FreeCells.AddUnique(Index);
+	}
+
+	// 1. 칸 선택 (기존과 같은 순서/난수 소비)
+	struct FPlannedSpawn
+	{
+		TSubclassOf<AEnemyCharacter> Class;
+		int32 Index;
+	};
+	TArray<FPlannedSpawn> Planned;
+	Planned.Reserve(Group.Classes.Num());
+
+	for (int32 i = 0; i < Group.Classes.Num(); ++i)
+	{
+		int32 SpawnIndex = INDEX_NONE;
+
+		if (Group.Rule == ESpawnCellRule::Fixed && Group.Cells.IsValidIndex(i) && IsFreeCell(Group.Cells[i]))
+		{
+			SpawnIndex = Group.Cells[i];
+			FreeCells.RemoveSwap(SpawnIndex);
+		}
+		else
+		{
+			if (FreeCells.Num() == 0) break;
+
+			const int32 Rnd = FMath::RandRange(0, FreeCells.Num() - 1);
+			SpawnIndex = FreeCells[Rnd];
+			FreeCells.RemoveAtSwap(Rnd);
+		}
+
+		// 로드 안 된 클래스는 스폰 실패와 동일 (칸만 소비)
+		TSubclassOf<AEnemyCharacter> SpawnClass = Group.Classes[i].Get();
+		if (!SpawnClass) continue;
+
+		Planned.Add({ SpawnClass, SpawnIndex });
+		PendingSpawnCells.Add(SpawnIndex);
+	}
+
+	// 칸이 없거나 클래스가 없어 못 나오는 적
+	DropExpectedEnemies(Group.Classes.Num() - Planned.Num(), TEXT("no cell / class"));
+
+	// 2. 실제 스폰 (풀 활성화/신규 스폰 + 등장 연출) 은 예산 안에서 한 마리씩
+	TWeakObjectPtr<ABattleManager> WeakThis(this);
+	RunSliced(TEXT("SpawnGroup"), Planned.Num(), [WeakThis, Planned = MoveTemp(Planned)](int32 Item)
+	{
+		ABattleManager* Self = WeakThis.Get();
+		if (!Self) return;
+
+		const FPlannedSpawn& Spawn = Planned[Item];
+		Self->PendingSpawnCells.RemoveSingleSwap(Spawn.Index, false);
+
+		AEnemyCharacter* NewEnemy = Self->AcquireEnemy(Spawn.Class, Self->GridGeometry.IndexToCoord(Spawn.Index), Spawn.Index);
+		if (NewEnemy)
+		{
+			Self->AddAliveEnemy(NewEnemy);
+		}
+		else
+		{
+			Self->DropExpectedEnemies(1, TEXT("spawn failed"));
+		}
+	}, nullptr);
+}
+
+void ABattleManager::RunSliced(FName Label, int32 NumItems, TFunction<void(int32)> ItemFn, TFunction<void()> OnComplete)
+{
+	if (UBattleWorkSlicerSubsystem* Slicer = GetWorld()->GetSubsystem<UBattleWorkSlicerSubsystem>())
+	{
+		Slicer->Enqueue(Label, NumItems, MoveTemp(ItemFn), MoveTemp(OnComplete));
+		return;
+	}
+
+	for (int32 i = 0; i < NumItems; ++i)
+	{
+		ItemFn(i);
+	}
+	if (OnComplete)
+	{
+		OnComplete();
+	}
+}
+
+// ───────── 생존 적 목록 ─────────
+
+void ABattleManager::AddAliveEnemy(AEnemyCharacter* Enemy)
+{
+	if (!Enemy || Enemies.Contains(Enemy)) return;
+
+	Enemies.Add(Enemy);
+	AliveEnemyCount = Enemies.Num();
+	BroadcastAliveEnemyCount();
+}
+
+void ABattleManager::RemoveAliveEnemy(AEnemyCharacter* Enemy)
+{
+	const int32 Index = Enemies.Find(Enemy);
+	if (Index == INDEX_NONE) return;
+
+	// 순서 유지 삭제 (행동 순서가 바뀌지 않도록 RemoveAtSwap 사용 안 함)
+	Enemies.RemoveAt(Index, 1, false);
+	AliveEnemyCount = Enemies.Num();
+
+	// 적 턴 순회 중이면 현재 인덱스 보정 (앞쪽 적이 죽으면 한 칸씩 당겨짐)
+	if (CurrentState == EBattleState::EnemyTurn && Index <= CurrentEnemyActionIndex)
+	{
+		CurrentEnemyActionIndex--;
+	}
+
+	Enemy->HideActionOrder();
+	BroadcastAliveEnemyCount();
+}
+
+void ABattleManager::BroadcastAliveEnemyCount()
+{
+	OnAliveEnemyCountChanged.Broadcast(AliveEnemyCount, GetRemainingEnemyCount());
+
+	if (UBattleHUDViewModel* HUD = UBattleHUDViewModel::Get(this))
+	{
+		HUD->SetEnemyCounts(AliveEnemyCount, GetRemainingEnemyCount());
+	}
+}
+
+void ABattleManager::PushTurnStateToHUD()
+{
+	if (UBattleHUDViewModel* HUD = UBattleHUDViewModel::Get(this))
+	{
+		HUD->SetTurn(TurnCount);
+		HUD->SetRound(CurrentRound);
+	}
+}
+
+// ───────── 스테이지 타임라인 ─────────
+
+const FCompiledRound* ABattleManager::GetCurrentCompiledRound() const
+{
+	if (!CurrentStageData) return nullptr;
+
+	const FStageRuntimePlan& Plan = CurrentStageData->GetRuntimePlan();
+	return Plan.Rounds.IsValidIndex(CurrentRoundIndex) ? &Plan.Rounds[CurrentRoundIndex] : nullptr;
+}
+
+bool ABattleManager::HasNextRound() const
+{
+	return CurrentStageData && CurrentStageData->GetRuntimePlan().Rounds.IsValidIndex(CurrentRoundIndex + 1);
+}
+
+bool ABattleManager::HasPendingSpawns() const
+{
+	if (HasNextRound()) return true;
+
+	// 아직 발동하지 않은 증원이 있는가?
+	return FiredWaves.Find(false) != INDEX_NONE;
+}
+
+bool ABattleManager::IsRoundTriggerMet(const FRoundTrigger& Trigger, bool bEnemyTurnEnd) const
+{
+	switch (Trigger.Type)
+	{
+	case ERoundTriggerType::AllKilled:			return !bEnemyTurnEnd && GetBoardEnemyCount() == 0;
+	case ERoundTriggerType::KillCount:			return RoundKillCount >= Trigger.Value;
+	case ERoundTriggerType::TurnCount:			return RoundTurnCount >= Trigger.Value;
+	case ERoundTriggerType::SingleEnemyTimer:	return bEnemyTurnEnd && GetBoardEnemyCount() == 1 && TurnsSinceSingleEnemy >= Trigger.Value;
+	}
+	return false;
+}
+
+void ABattleManager::EvaluateStageTimeline(bool bEnemyTurnEnd)
+{
+	const FCompiledRound* Round = GetCurrentCompiledRound();
+	if (!Round) return;
+
+	// 1. 증원 (라운드당 한 번씩)
+	for (int32 i = 0; i < Round->Waves.Num(); ++i)
+	{
+		if (!FiredWaves[i] && IsRoundTriggerMet(Round->Waves[i].Trigger, bEnemyTurnEnd))
+		{
+			FiredWaves[i] = true;
+			UE_LOG(LogBattle, Log, TEXT(">>> Reinforcement %d (Round %d)"), i + 1, CurrentRound);
+			SpawnGroup(Round->Waves[i].GroupIndex);
+		}
+	}
+
+	// 2. 다음 라운드 진행
+	if (HasNextRound())
+	{
+		for (const FRoundTrigger& Trigger : Round->AdvanceTriggers)
+		{
+			if (IsRoundTriggerMet(Trigger, bEnemyTurnEnd))
+			{
+				StartNextRound();
+				return;
+			}
+		}
+	}
+	// 3. 마지막 라운드에서 전멸했는데 남은 증원이 있으면 전부 투입
+	else if (!bEnemyTurnEnd && GetBoardEnemyCount() == 0)
+	{
+		for (int32 i = 0; i < Round->Waves.Num(); ++i)
+		{
+			if (!FiredWaves[i])
+			{
+				FiredWaves[i] = true;
+				SpawnGroup(Round->Waves[i].GroupIndex);
+			}
+		}
+	}
+}
+
+// ───────── 적 풀링 ─────────
+
+void ABattleManager::PrewarmEnemyPool()
+{
+	if (!CurrentStageData || !GridGeometry.IsValid()) return;
+
+	// 클래스별 필요 수 = 스테이지 전체 등장 수 (라운드 + 증원, 보드 칸 수로 제한)
+	TMap<TSubclassOf<AEnemyCharacter>, int32> Needed;
+	for (const FCompiledSpawnGroup& Group : CurrentStageData->GetRuntimePlan().Groups)
 	{
-		if (Enemy && !Enemy->bDead)
+		for (const TSoftClassPtr<AEnemyCharacter>& EnemyClassToSpawn : Group.Classes)
 		{
-			ValidIndices.Remove(Enemy->GridIndex);
+			// 스테이지 로드 시 함께 로드됨 (실패한 클래스는 건너뜀)
+			if (UClass* Loaded = EnemyClassToSpawn.Get())
+			{
+				Needed.FindOrAdd(Loaded)++;
+			}
 		}
 	}
 
-	// 소환 루프
-	for (TSubclassOf<AEnemyCharacter> EnemyClassToSpawn : RoundInfo.EnemiesToSpawn)
+	const int32 CellCount = GridGeometry.Num();
+
+	for (const TPair<TSubclassOf<AEnemyCharacter>, int32>& Pair : Needed)
 	{
-		if (!EnemyClassToSpawn) continue;
-		if (ValidIndices.Num() == 0) break;
+		FEnemyPoolBucket& Bucket = EnemyPool.FindOrAdd(Pair.Key);
+		const int32 Target = FMath::Min(Pair.Value, CellCount);
 
-		int32 Rnd = FMath::RandRange(0, ValidIndices.Num() - 1);
-		int32 SpawnIndex = ValidIndices[Rnd];
-		ValidIndices.RemoveAt(Rnd);
+		while (Bucket.Inactive.Num() < Target)
+		{
+			AEnemyCharacter* Pooled = SpawnEnemyActor(Pair.Key, FIntPoint(-1, -1), -1, true);
+			if (!Pooled) break;
+			Bucket.Inactive.Add(Pooled);
+		}
+	}
+}
 
-		FIntPoint Coord = GetGridCoordFromIndex(SpawnIndex);
-		FVector Loc = GetWorldLocation(Coord);
+AEnemyCharacter* ABattleManager::AcquireEnemy(TSubclassOf<AEnemyCharacter> EnemyClassToSpawn, FIntPoint Coord, int32 Index)
+{
+	if (FEnemyPoolBucket* Bucket = EnemyPool.Find(EnemyClassToSpawn))
+	{
+		while (Bucket->Inactive.Num() > 0)
+		{
+			AEnemyCharacter* Pooled = Bucket->Inactive.Pop(false);
+			if (IsValid(Pooled))
+			{
+				Pooled->ActivateFromPool(Coord, Index);
+				return Pooled;
+			}
+		}
+	}
+
+	// 풀이 비었으면 기존처럼 새로 스폰
+	return SpawnEnemyActor(EnemyClassToSpawn, Coord, Index, false);
+}
+
+AEnemyCharacter* ABattleManager::SpawnEnemyActor(TSubclassOf<AEnemyCharacter> EnemyClassToSpawn, FIntPoint Coord, int32 Index, bool bForPool)
+{
+	if (!EnemyClassToSpawn) return nullptr;
+	BATTLE_LLM_SCOPE(Enemies); // 메시/ASC/위젯 컴포넌트가 스폰 중에 생성됨
+
+	FVector Loc = PoolParkingLocation;
+	if (!bForPool)
+	{
+		Loc = GetWorldLocation(Coord);
 
 		// Z오프셋 적용
 		float ZOffset = 100.f;
@@ -282,26 +693,37 @@ void ABattleManager::SpawnCurrentRoundEnemies()
 			ZOffset = EnemyClassToSpawn.GetDefaultObject()->SpawnZOffset;
 		}
 		Loc.Z += ZOffset;
+	}
 
-		FRotator SpawnRot = FRotator(0.0f, 180.0f, 0.0f);
-
-		FTransform SpawnTransform(FRotator::ZeroRotator, Loc);
+	FTransform SpawnTransform(FRotator::ZeroRotator, Loc);
 
-		AEnemyCharacter* NewEnemy = GetWorld()->SpawnActorDeferred<AEnemyCharacter>(
-			EnemyClassToSpawn,
-			SpawnTransform,
-			nullptr, nullptr,
-			ESpawnActorCollisionHandlingMethod::AlwaysSpawn
-		);
+	AEnemyCharacter* NewEnemy = GetWorld()->SpawnActorDeferred<AEnemyCharacter>(
+		EnemyClassToSpawn,
+		SpawnTransform,
+		nullptr, nullptr,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+	);
 
-		if (NewEnemy)
-		{
-			NewEnemy->GridCoord = Coord;
-			NewEnemy->GridIndex = SpawnIndex;
-			UGameplayStatics::FinishSpawningActor(NewEnemy, SpawnTransform);
-			Enemies.Add(NewEnemy);
-		}
+	if (NewEnemy)
+	{
+		NewEnemy->GridCoord = Coord;
+		NewEnemy->GridIndex = Index;
+		NewEnemy->bInPool = bForPool;
+		UGameplayStatics::FinishSpawningActor(NewEnemy, SpawnTransform);
 	}
+
+	return NewEnemy;
+}
+
+void ABattleManager::ReleaseEnemy(AEnemyCharacter* Enemy)
+{
+	if (!IsValid(Enemy)) return;
+
+	// Enemies 목록에서는 사망 시점(OnEnemyKilled)에 이미 빠져 있음
+	Enemy->DeactivateForPool();
+	Enemy->SetActorLocation(PoolParkingLocation, false, nullptr, ETeleportType::ResetPhysics);
+
+	EnemyPool.FindOrAdd(Enemy->GetClass()).Inactive.AddUnique(Enemy);
 }
 
 void ABattleManager::StartNextRound()
@@ -309,20 +731,34 @@ void ABattleManager::StartNextRound()
 	if (!CurrentStageData) return;
 
 	// 다음 라운드가 있으면 진행
-	if (CurrentStageData->Rounds.IsValidIndex(CurrentRoundIndex + 1))
+	if (HasNextRound())
 	{
-		Enemies.RemoveAll([](AEnemyCharacter* E) { return E == nullptr || E->bDead; });
+		// 이번 라운드에서 발동하지 못한 증원은 버려지므로 총합에서 제외
+		if (const FCompiledRound* Round = GetCurrentCompiledRound())
+		{
+			const FStageRuntimePlan& Plan = CurrentStageData->GetRuntimePlan();
+			int32 Dropped = 0;
+			for (int32 i = 0; i < Round->Waves.Num(); ++i)
+			{
+				if (FiredWaves.IsValidIndex(i) && !FiredWaves[i] && Plan.Groups.IsValidIndex(Round->Waves[i].GroupIndex))
+				{
+					Dropped += Plan.Groups[Round->Waves[i].GroupIndex].Classes.Num();
+				}
+			}
+			DropExpectedEnemies(Dropped, TEXT("unfired waves"));
+		}
 
 		CurrentRoundIndex++;
 		CurrentRound++;
 		TurnsSinceSingleEnemy = 0;
 
-		UE_LOG(LogTemp, Warning, TEXT(">>> Next Round Started! (Round %d)"), CurrentRound);
+		UE_LOG(LogBattle, Log, TEXT(">>> Next Round Started! (Round %d)"), CurrentRound);
+		UCombatEventBusSubsystem::Publish(this, ECombatEventType::RoundStart, nullptr, nullptr, FIntPoint::ZeroValue, CurrentRound);
 		SpawnCurrentRoundEnemies();
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("No More Rounds."));
+		UE_LOG(LogBattle, Verbose, TEXT("No More Rounds."));
 	}
 }
 
@@ -333,55 +769,35 @@ void ABattleManager::OnEnemyKilled(AEnemyCharacter* DeadEnemy)
 	if (UPortfolioGameInstance* GI = Cast<UPortfolioGameInstance>(GetGameInstance()))
 	{
 		GI->TotalKillCount++;
-		UE_LOG(LogTemp, Warning, TEXT("Total Game Kills: %d"), GI->TotalKillCount);
+		UE_LOG(LogBattle, Verbose, TEXT("Total Game Kills: %d"), GI->TotalKillCount);
 	}
 
-	// 살아있는 적 수 계산 (방금 죽은 적 제외)
-	int32 AliveCount = 0;
-	for (AEnemyCharacter* E : Enemies)
-	{
-		if (E && !E->bDead && E != DeadEnemy) AliveCount++;
-	}
+	// 생존 목록/카운터 갱신 (배열 재순회 없음)
+	RoundKillCount++;
+	RemoveAliveEnemy(DeadEnemy);
 
-	if (AliveCount == 0)
+	if (GetBoardEnemyCount() == 0 && !HasPendingSpawns())
 	{
-		bool bHasNextRound = (CurrentStageData && CurrentStageData->Rounds.IsValidIndex(CurrentRoundIndex + 1));
-
-		if (!bHasNextRound)
-		{
-			// 마지막 라운드까지 다 잡았으면 -> 클리어 대기 (2초 뒤 이동 등)
-			FTimerHandle ClearHandle;
-			GetWorld()->GetTimerManager().SetTimer(ClearHandle, this, &ABattleManager::ForceStageClear, 2.0f, false);
-		}
+		// 마지막 라운드 + 증원까지 다 잡았으면 -> 클리어 대기 (2초 뒤 이동 등)
+		FTimerHandle ClearHandle;
+		GetWorld()->GetTimerManager().SetTimer(ClearHandle, this, &ABattleManager::ForceStageClear, 2.0f, false);
 	}
 }
 
 void ABattleManager::CheckSingleEnemyTimer()
 {
-	int32 AliveCount = 0;
-	for (AEnemyCharacter* Enemy : Enemies)
-	{
-		if (Enemy && !Enemy->bDead) AliveCount++;
-	}
-
-	if (AliveCount == 1)
+	if (GetBoardEnemyCount() == 1)
 	{
 		TurnsSinceSingleEnemy++;
-		UE_LOG(LogTemp, Warning, TEXT("1 enemy left for %d turn(s)"), TurnsSinceSingleEnemy);
-
-		// 2턴 지남 & 다음 라운드 존재 시 강제 진행
-		if (TurnsSinceSingleEnemy >= 2)
-		{
-			if (CurrentStageData && CurrentStageData->Rounds.IsValidIndex(CurrentRoundIndex + 1))
-			{
-				StartNextRound(); // 강제 증원
-			}
-		}
+		UE_LOG(LogBattle, Verbose, TEXT("1 enemy left for %d turn(s)"), TurnsSinceSingleEnemy);
 	}
 	else
 	{
 		TurnsSinceSingleEnemy = 0;
 	}
+
+	// 적 턴 종료 시점 트리거 (SingleEnemyTimer / KillCount 등)
+	EvaluateStageTimeline(true);
 }
 
 void ABattleManager::EndBattle(bool bPlayerVictory)
@@ -389,82 +805,99 @@ void ABattleManager::EndBattle(bool bPlayerVictory)
 	if (bPlayerVictory)
 	{
 		CurrentState = EBattleState::Victory;
-		UE_LOG(LogTemp, Warning, TEXT("BATTLE VICTORY"));
+		UE_LOG(LogBattle, Log, TEXT("BATTLE VICTORY"));
 	}
 	else
 	{
 		CurrentState = EBattleState::Defeat;
-		UE_LOG(LogTemp, Warning, TEXT("BATTLE DEFEAT"));
+		UE_LOG(LogBattle, Log, TEXT("BATTLE DEFEAT"));
 		
 	}
+	FBattleAllocTracker::EndTurn();
 }
 
 void ABattleManager::StartPlayerTurn()
 {
-	int32 AliveCount = 0;
-	for (AEnemyCharacter* E : Enemies)
-	{
-		if (E && !E->bDead) AliveCount++;
-	}
-	if (AliveCount == 0 && CurrentStageData && CurrentStageData->Rounds.IsValidIndex(CurrentRoundIndex + 1))
-	{
-		StartNextRound();
-	}
-
+	// 플레이어 턴 시작 시점 트리거 (AllKilled / TurnCount 등)
+	RoundTurnCount++;
+	EvaluateStageTimeline(false);
 
 	TurnCount++;
-	UE_LOG(LogTemp, Warning, TEXT("TURN %d: PLAYER TURN"), TurnCount);
+	UE_LOG(LogBattle, Verbose, TEXT("TURN %d: PLAYER TURN"), TurnCount);
 	CurrentState = EBattleState::PlayerTurn;
+	UCombatEventBusSubsystem::Publish(this, ECombatEventType::TurnStart, PlayerRef, nullptr, FIntPoint::ZeroValue, TurnCount);
 
-	for (AEnemyCharacter* Enemy : Enemies)
+	// 증원 스폰이 분할 중이면 다 나온 뒤에 계획 (적 목록/순번이 분할 없을 때와 같도록)
+	TWeakObjectPtr<ABattleManager> WeakThis(this);
+	RunSliced(TEXT("EnemyPlanningWait"), 0, nullptr, [WeakThis]()
 	{
-		if (Enemy) Enemy->HideActionOrder();
-	}
-
-	int32 AliveEnemyCount = 0;
+		if (WeakThis.IsValid())
+		{
+			WeakThis->PlanEnemyTurnSliced();
+		}
+	});
+}
 
-	for (int32 i = 0; i < Enemies.Num(); ++i)
+void ABattleManager::PlanEnemyTurnSliced()
+{
+	// 적 1명씩 행동 결정 + 순번 표시 (Enemies는 생존 적만 들고 있으므로 순번 = 배열 순서)
+	TWeakObjectPtr<ABattleManager> WeakThis(this);
+	RunSliced(TEXT("EnemyPlanning"), Enemies.Num(), [WeakThis](int32 i)
 	{
-		AEnemyCharacter* Enemy = Enemies[i];
+		ABattleManager* Self = WeakThis.Get();
+		if (!Self || !Self->Enemies.IsValidIndex(i)) return;
+
+		BATTLE_PHASE_SCOPE(EBattlePhase::EnemyPlanning, Self, Self->Enemies[i]);
 
-		if (Enemy && !Enemy->bDead)
+		AEnemyCharacter* Enemy = Self->Enemies[i];
+		if (Enemy)
 		{
-			AliveEnemyCount++;
+			Enemy->HideActionOrder();
 			Enemy->DecideNextAction();
 
 			UTexture2D* SubIcon = nullptr;
-			if (OrderManagerRef)
+			if (Self->OrderManagerRef)
 			{
-				SubIcon = OrderManagerRef->GetIconForAction(Enemy);
+				SubIcon = Self->OrderManagerRef->GetIconForAction(Enemy);
 			}
 
 			bool bIsDangerous = (Enemy->ReservedSkill != nullptr) ||
 				(Enemy->PendingAction == EAIActionType::FireReserved);
 
-			Enemy->SetActionOrder(AliveEnemyCount, SubIcon, bIsDangerous);
+			Enemy->SetActionOrder(i + 1, SubIcon, bIsDangerous);
 		}
-	}
+	},
+	[WeakThis]()
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->FinishPlayerTurnStart();
+		}
+	});
+}
 
+void ABattleManager::FinishPlayerTurnStart()
+{
 	if (OrderManagerRef)
 	{
 		OrderManagerRef->UpdateActionQueue(Enemies);
 	}
 
+	// 계획이 모두 끝난 뒤에만 플레이어 입력 허용 (그 전 입력은 라우터 버퍼에 보관)
 	if (PlayerRef)
 	{
 		PlayerRef->ReduceCooldowns();
 		PlayerRef->OnTurnStart_BPEvent.Broadcast();
 		PlayerRef->StartAction();
 	}
-
-	
 }
 
 void ABattleManager::StartEnemyTurn()
 {
-	UE_LOG(LogTemp, Warning, TEXT("TURN %d: ENEMY TURN"), TurnCount);
+	UE_LOG(LogBattle, Verbose, TEXT("TURN %d: ENEMY TURN"), TurnCount);
 	CurrentState = EBattleState::EnemyTurn;
 	CurrentEnemyActionIndex = 0;
+	UCombatEventBusSubsystem::Publish(this, ECombatEventType::TurnStart, nullptr, nullptr, FIntPoint::ZeroValue, TurnCount);
 	ProcessNextEnemyAction();
 }
 
@@ -473,7 +906,7 @@ void ABattleManager::ProcessNextEnemyAction()
 	if (CurrentEnemyActionIndex >= Enemies.Num())
 	{
 		CheckSingleEnemyTimer(); // 라운드 체크
-		GetWorld()->GetTimerManager().SetTimer(TurnDelayHandle, this, &ABattleManager::StartPlayerTurn, 0.2f, false);
+		GetWorld()->GetTimerManager().SetTimer(TurnDelayHandle, this, &ABattleManager::StartPlayerTurn, UPortfolioGameInstance::GetTurnStepDelay(this, TurnStepDelay), false);
 		return;
 	}
 
@@ -485,6 +918,7 @@ void ABattleManager::ProcessNextEnemyAction()
 		ProcessNextEnemyAction();
 		return;
 	}
+	BATTLE_PHASE_SCOPE(EBattlePhase::EnemyAction, this, CurrentEnemy);
 	CurrentEnemy->StartAction();
 	CurrentEnemy->ExecutePlannedAction();
 }
@@ -496,12 +930,12 @@ void ABattleManager::EndCharacterTurn(ACharacterBase* Character)
 
 	if (Cast<APlayerCharacter>(Character))
 	{
-		GetWorld()->GetTimerManager().SetTimer(TurnDelayHandle, this, &ABattleManager::StartEnemyTurn, 0.2f, false);
+		GetWorld()->GetTimerManager().SetTimer(TurnDelayHandle, this, &ABattleManager::StartEnemyTurn, UPortfolioGameInstance::GetTurnStepDelay(this, TurnStepDelay), false);
 	}
 	else if (Cast<AEnemyCharacter>(Character))
 	{
 		CurrentEnemyActionIndex++;
-		GetWorld()->GetTimerManager().SetTimer(TurnDelayHandle, this, &ABattleManager::ProcessNextEnemyAction, 0.2f, false);
+		GetWorld()->GetTimerManager().SetTimer(TurnDelayHandle, this, &ABattleManager::ProcessNextEnemyAction, UPortfolioGameInstance::GetTurnStepDelay(this, TurnStepDelay), false);
 	}
 }
 
@@ -543,37 +977,71 @@ void ABattleManager::SpawnPlayer_Implementation()
 void ABattleManager::ForceStageClear()
 {
 	if (CurrentState == EBattleState::Victory) return;
+
+	BATTLE_PHASE_SCOPE(EBattlePhase::LevelTransition, this, nullptr);
 	EndBattle(true);
 
-	if (PlayerRef && PlayerRef->Attributes)
+	// 강화 단계는 레벨 이동 없이 여기서 진행 (저장/이동은 강화 매니저의 CompleteStage가 처리)
+	if (TryStartEnforceOverlay()) return;
+
+	UPortfolioGameInstance* GI = Cast<UPortfolioGameInstance>(GetGameInstance());
+	if (PlayerRef && PlayerRef->Attributes && GI)
 	{
-		UPortfolioGameInstance* GI = Cast<UPortfolioGameInstance>(GetGameInstance());
-		if (GI)
-		{
-			float HP = PlayerRef->Attributes->GetHealth_BP();
-			float MaxHP = PlayerRef->Attributes->GetMaxHealth_BP();
-			GI->SavePlayerData(HP, MaxHP, PlayerRef->OwnedSkills);
-			GI->bIsLevelTransitioning = true;
-		}
+		float HP = PlayerRef->Attributes->GetHealth_BP();
+		float MaxHP = PlayerRef->Attributes->GetMaxHealth_BP();
+		GI->SavePlayerData(HP, MaxHP, PlayerRef->OwnedSkills);
+		GI->bIsLevelTransitioning = true;
 	}
 
-	if (TransitionWidgetClass)
+	// 덮는 동안 다음 맵 패키지를 미리 읽어 둠
+	if (GI)
 	{
-		UUserWidget* Widget = CreateWidget<UUserWidget>(GetWorld(), TransitionWidgetClass);
-		if (Widget)
-		{
-			Widget->AddToViewport(9999);
-			FOutputDeviceNull Ar;
-			Widget->CallFunctionByNameWithArguments(TEXT("PlayCover"), Ar, nullptr, true);
-		}
+		GI->PreloadStageMap(GI->PeekNextStageName());
+	}
+
+	// 덮은 전환 위젯은 다음 레벨까지 그대로 유지됨
+	UBattleUILayerSubsystem* UILayer = UBattleUILayerSubsystem::Get(this);
+	if (TransitionWidgetClass && UILayer)
+	{
+		UILayer->PlayCover(TransitionWidgetClass);
 	}
 
 	FTimerHandle Handle;
 	GetWorld()->GetTimerManager().SetTimer(Handle, this, &ABattleManager::MoveToNextLevel, 2.6f, false);
 }
 
+bool ABattleManager::TryStartEnforceOverlay()
+{
+	UPortfolioGameInstance* GI = Cast<UPortfolioGameInstance>(GetGameInstance());
+	if (!GI || !EnforceOverlayClass || EnforceOverlay) return false;
+	if (!GI->IsOverlayEnforceStage(GI->PeekNextStageName())) return false;
+
+	const FTransform SpawnTransform = GetActorTransform();
+	AEnforceManager* Overlay = GetWorld()->SpawnActorDeferred<AEnforceManager>(EnforceOverlayClass, SpawnTransform, this);
+	if (!Overlay) return false;
+
+	// 강화 단계로 진행 (루프/난이도 처리는 기존과 동일, 다음 맵 이동 때 한 번 더 진행)
+	const FName EnforceStage = GI->GetNextStageName();
+
+	// 카드를 고르는 동안 다음 전투 맵 패키지를 미리 로드
+	GI->PreloadStageMap(GI->PeekNextStageName());
+
+	Overlay->bOverlayMode = true;
+	UGameplayStatics::FinishSpawningActor(Overlay, SpawnTransform);
+	EnforceOverlay = Overlay;
+
+	UE_LOG(LogBattle, Log, TEXT("Enforce stage %s started as overlay (next: %s)"),
+		*EnforceStage.ToString(), *GI->PeekNextStageName().ToString());
+
+	// 맵 로드 없는 스테이지 전환이므로 여기서 리포트
+	FBattleMemoryReport::OnStageTransition(GetWorld(), EnforceStage, GI->DifficultyLevel);
+	return true;
+}
+
 void ABattleManager::MoveToNextLevel()
 {
+	BATTLE_PHASE_SCOPE(EBattlePhase::LevelTransition, this, nullptr);
+
 	UPortfolioGameInstance* GI = Cast<UPortfolioGameInstance>(GetGameInstance());
 	if (GI)
 	{
@@ -585,33 +1053,69 @@ void ABattleManager::MoveToNextLevel()
 	}
 }
 
-FVector ABattleManager::GridToWorld(FIntPoint GridPos) const
+// ───────── 시간제 이펙트 ─────────
+
+void ABattleManager::RegisterTimedEffect(UNiagaraComponent* Effect, float LifeTime)
 {
-	if (!GridInterface) return FVector::ZeroVector;
-	const double SizeX = IGridDataInterface::Execute_GetGridSizeX(GridActorRef);
-	const double SizeY = IGridDataInterface::Execute_GetGridSizeY(GridActorRef);
-	return FVector(GridPos.X * SizeX, GridPos.Y * SizeY, 0.f);
+	if (!Effect) return;
+
+	FTimedEffect& Entry = TimedEffects.AddDefaulted_GetRef();
+	Entry.Component = Effect;
+	Entry.ExpireTime = GetWorld()->GetTimeSeconds() + LifeTime;
+
+	// 등록된 이펙트가 있는 동안만 도는 타이머 하나
+	if (!GetWorld()->GetTimerManager().IsTimerActive(TimedEffectHandle))
+	{
+		GetWorld()->GetTimerManager().SetTimer(TimedEffectHandle, this, &ABattleManager::ExpireTimedEffects, 0.25f, true);
+	}
 }
 
-FVector ABattleManager::GetWorldLocation(FIntPoint GridPos) const
+void ABattleManager::ExpireTimedEffects()
 {
-	if (!GridInterface) return FVector::ZeroVector;
+	const double Now = GetWorld()->GetTimeSeconds();
 
-	// 1. 순수 로컬 좌표 계산 (X * Size, Y * Size)
-	const FVector CellLocalPos = GridToWorld(GridPos);
+	TimedEffects.RemoveAllSwap([Now](const FTimedEffect& Entry)
+		{
+			if (!Entry.Component.IsValid()) return true;
+			if (Entry.ExpireTime > Now) return false;
 
-	// 2. 로컬 오프셋 더하기 (미세 조정값)
-	const FVector LocalOffset = IGridDataInterface::Execute_GetGridLocationOffset(GridActorRef);
-	FVector FinalLocalPos = CellLocalPos + LocalOffset;
+			// 강제로 정리 (Infinite 루프 이펙트 방지)
+			Entry.Component->Deactivate();
+			Entry.Component->DestroyComponent();
+			return true;
+		}, false);
 
-	// 3. ★ [핵심] 로컬 좌표 -> 월드 좌표 변환 (TransformPosition)
-	// GridActorRef가 회전해 있거나 이동해 있어도, 그 기준으로 변환해 줍니다.
-	if (GridActorRef)
+	if (TimedEffects.Num() == 0)
 	{
-		return GridActorRef->GetActorTransform().TransformPosition(FinalLocalPos);
+		GetWorld()->GetTimerManager().ClearTimer(TimedEffectHandle);
 	}
+}
+
+void ABattleManager::RefreshGridGeometry()
+{
+	GridGeometry.Build(GridActorRef);
+
+	UE_LOG(LogBattle, Verbose, TEXT("Grid geometry rebuilt: %dx%d, cell %.1fx%.1f"),
+		GridGeometry.Width, GridGeometry.Height, GridGeometry.CellSizeX, GridGeometry.CellSizeY);
+}
+
+void ABattleManager::OnGridTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	RefreshGridGeometry();
+}
+
+FVector ABattleManager::GridToWorld(FIntPoint GridPos) const
+{
+	if (!GridGeometry.IsValid()) return FVector::ZeroVector;
+	return GridGeometry.CoordToLocal(GridPos);
+}
+
+FVector ABattleManager::GetWorldLocation(FIntPoint GridPos) const
+{
+	if (!GridGeometry.IsValid()) return FVector::ZeroVector;
 
-	return FinalLocalPos;
+	// 로컬 좌표 + 오프셋 -> 그리드 액터 트랜스폼 적용 (보드 안 칸은 미리 계산된 테이블 조회)
+	return GridGeometry.CoordToWorld(GridPos);
 }
 
 FVector ABattleManager::GetWorldLocationForCharacter(ACharacterBase* Character) const
@@ -622,14 +1126,14 @@ FVector ABattleManager::GetWorldLocationForCharacter(ACharacterBase* Character)
 
 int32 ABattleManager::GetGridIndexFromCoord(FIntPoint Coord) const
 {
-	if (!GridInterface) return -1;
-	return IGridDataInterface::Execute_GetGridIndexFromCoord(GridActorRef, Coord);
+	if (!GridGeometry.IsValid()) return -1;
+	return GridGeometry.CoordToIndex(Coord);
 }
 
 FIntPoint ABattleManager::GetGridCoordFromIndex(int32 Index) const
 {
-	if (!GridInterface) return FIntPoint(-1, -1);
-	return IGridDataInterface::Execute_GetGridCoordFromIndex(GridActorRef, Index);
+	if (!GridGeometry.IsValid()) return FIntPoint(-1, -1);
+	return GridGeometry.IndexToCoord(Index);
 }
 
 ACharacterBase* ABattleManager::GetCharacterAt(FIntPoint Coord) const
@@ -637,19 +1141,13 @@ ACharacterBase* ABattleManager::GetCharacterAt(FIntPoint Coord) const
 	if (PlayerRef && !PlayerRef->bDead && PlayerRef->GridCoord == Coord) return PlayerRef;
 	for (AEnemyCharacter* Enemy : Enemies)
 	{
-		if (Enemy && !Enemy->bDead && Enemy->GridCoord == Coord) return Enemy;
+		if (Enemy && Enemy->GridCoord == Coord) return Enemy;
 	}
 	return nullptr;
 }
 
 void ABattleManager::CheckBattleResult()
 {
-	int32 AliveEnemies = 0;
-	for (AEnemyCharacter* Enemy : Enemies)
-	{
-		if (Enemy && !Enemy->bDead) AliveEnemies++;
-	}
-
 	/*if (PlayerRef && PlayerRef->bDead)
 	{
 		EndBattle(false);
@@ -661,8 +1159,81 @@ void ABattleManager::OnPlayerDeathFinished()
 	EndBattle(false); // 이때 진짜 게임 오버 위젯을 띄움
 }
 
+void ABattleManager::DropExpectedEnemies(int32 Count, const TCHAR* Reason)
+{
+	if (Count <= 0) return;
+
+	TotalEnemiesInStage = FMath::Max(CurrentKillCount, TotalEnemiesInStage - Count);
+	MaxKillCount = TotalEnemiesInStage;
+	UE_LOG(LogBattle, Verbose, TEXT("%d expected enemy(s) dropped (%s) -> stage total %d"), Count, Reason, TotalEnemiesInStage);
+
+	BroadcastAliveEnemyCount();
+}
+
 int32 ABattleManager::GetRemainingEnemyCount() const
 {
 	// 음수 방지를 위해 Max 사용
 	return FMath::Max(0, TotalEnemiesInStage - CurrentKillCount);
-}
\ No newline at end of file
+}
+
+// ───────── 보드 상태 덤프 (단계 모니터용) ─────────
+#if !UE_BUILD_SHIPPING
+FString ABattleManager::DescribeBoardState() const
+{
+	FString Out = FString::Printf(TEXT("  Board: %s, Turn %d, Round %d, Kills %d/%d\n"),
+		*UEnum::GetValueAsString(CurrentState), TurnCount, CurrentRound, CurrentKillCount, MaxKillCount);
+
+	// 1. 그리드 배치도 (P = 플레이어, 숫자 = Enemies 배열 순번, . = 빈 칸)
+	if (GridGeometry.IsValid())
+	{
+		const int32 W = GridGeometry.Width;
+		const int32 H = GridGeometry.Height;
+
+		for (int32 Y = 0; Y < H; ++Y)
+		{
+			FString Row = TEXT("    ");
+			for (int32 X = 0; X < W; ++X)
+			{
+				const ACharacterBase* Char = GetCharacterAt(FIntPoint(X, Y));
+				if (!Char)
+				{
+					Row += TEXT(". ");
+				}
+				else if (Char == PlayerRef)
+				{
+					Row += TEXT("P ");
+				}
+				else
+				{
+					Row += FString::Printf(TEXT("%d "), Enemies.IndexOfByPredicate([Char](const AEnemyCharacter* E) { return E == Char; }) % 10);
+				}
+			}
+			Out += Row + TEXT("\n");
+		}
+	}
+
+	// 2. 유닛 목록
+	if (PlayerRef)
+	{
+		Out += FString::Printf(TEXT("  P %s (%d,%d) %s HP %.0f Dead %d\n"),
+			*PlayerRef->GetName(), PlayerRef->GridCoord.X, PlayerRef->GridCoord.Y,
+			*UEnum::GetValueAsString(PlayerRef->FacingDirection),
+			PlayerRef->Attributes ? PlayerRef->Attributes->GetHP() : 0.0f, PlayerRef->bDead);
+	}
+
+	for (int32 i = 0; i < Enemies.Num(); ++i)
+	{
+		const AEnemyCharacter* Enemy = Enemies[i];
+		if (!Enemy) continue;
+
+		Out += FString::Printf(TEXT("  %d %s (%d,%d) %s HP %.0f Pending %s Reserved %s Dead %d\n"),
+			i, *Enemy->GetName(), Enemy->GridCoord.X, Enemy->GridCoord.Y,
+			*UEnum::GetValueAsString(Enemy->FacingDirection),
+			Enemy->Attributes ? Enemy->Attributes->GetHP() : 0.0f,
+			*UEnum::GetValueAsString(Enemy->PendingAction),
+			*GetNameSafe(Enemy->ReservedSkill), Enemy->bDead);
+	}
+
+	return Out;
+}
+#endif
@@ -0,0 +1,270 @@
+﻿#include "BattleMemoryReport.h"
+#include "Portfolio2Game.h"
+#include "EnemyCharacter.h"
+#include "StageData.h"
+#include "Blueprint/UserWidget.h"
+#include "NiagaraComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/UObjectIterator.h"
+
+LLM_DEFINE_TAG(Battle);
+LLM_DEFINE_TAG(Battle_Grid, TEXT("Grid"), TEXT("Battle"));
+LLM_DEFINE_TAG(Battle_Enemies, TEXT("Enemies"), TEXT("Battle"));
+LLM_DEFINE_TAG(Battle_SkillFX, TEXT("SkillFX"), TEXT("Battle"));
+LLM_DEFINE_TAG(Battle_StageData, TEXT("StageData"), TEXT("Battle"));
+LLM_DEFINE_TAG(Battle_UI, TEXT("UI"), TEXT("Battle"));
+
+#if !UE_BUILD_SHIPPING
+
+namespace BattleMemoryPrivate
+{
+	static TAutoConsoleVariable<bool> CVarReportOnTransition(
+		TEXT("Battle.Memory.ReportOnTransition"),
+		true,
+		TEXT("스테이지 전환(맵 로드 완료 / 오버레이 강화 시작)마다 메모리 예산 리포트를 출력합니다."));
+
+	// 태그별 예산 (MB) - 한 스테이지 분량 기준, 넘으면 리포트에 OVER 표시
+	static const double TagBudgetMB[(int32)EBattleMemTag::Count] =
+	{
+		8.0,	// Grid
+		96.0,	// Enemies
+		32.0,	// SkillFX
+		4.0,	// StageData
+		32.0,	// UI
+	};
+
+	// LLM 조회용 고유 이름 (LLM_DEFINE_TAG의 밑줄 -> 슬래시)
+	static const TCHAR* TagPaths[(int32)EBattleMemTag::Count] =
+	{
+		TEXT("Battle/Grid"),
+		TEXT("Battle/Enemies"),
+		TEXT("Battle/SkillFX"),
+		TEXT("Battle/StageData"),
+		TEXT("Battle/UI"),
+	};
+
+	struct FSnapshot
+	{
+		FName Stage;
+		int32 Difficulty = 0;
+		int32 Sequence = 0;			// 런 시작 후 몇 번째 스냅샷인지
+
+		bool bHasLLM = false;
+		int64 TagBytes[(int32)EBattleMemTag::Count] = {};
+		uint64 UsedPhysical = 0;
+
+		int32 NumObjects = 0;
+		int32 NumWorlds = 0;
+		int32 NumStaleActors = 0;	// 현재 월드가 아닌 게임 월드에 남은 액터 (OpenLevel 누수 후보)
+		int32 NumEnemies = 0;
+		int32 NumWidgets = 0;
+		int32 NumNiagara = 0;
+		int32 NumStageData = 0;
+	};
+
+	static bool bHasFirst = false;
+	static FSnapshot First;
+	static FSnapshot Previous;
+	static int32 NumSnapshots = 0;
+
+	static bool IsLiveInstance(const UObject* Obj)
+	{
+		return !Obj->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject);
+	}
+
+	template<typename T>
+	static int32 CountLive()
+	{
+		int32 Count = 0;
+		for (TObjectIterator<T> It; It; ++It)
+		{
+			if (IsLiveInstance(*It)) ++Count;
+		}
+		return Count;
+	}
+
+	static FSnapshot Capture(UWorld* World, FName StageName, int32 Difficulty)
+	{
+		FSnapshot Snap;
+		Snap.Stage = StageName;
+		Snap.Difficulty = Difficulty;
+		Snap.Sequence = NumSnapshots;
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+		if (FLowLevelMemTracker::IsEnabled())
+		{
+			Snap.bHasLLM = true;
+			for (int32 i = 0; i < (int32)EBattleMemTag::Count; ++i)
+			{
+				Snap.TagBytes[i] = FLowLevelMemTracker::Get().GetTagAmountForTracker(ELLMTracker::Default, FName(TagPaths[i]), ELLMTagSet::None);
+			}
+		}
+#endif
+
+		Snap.UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+		Snap.NumObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+		for (TObjectIterator<UWorld> It; It; ++It)
+		{
+			if (It->WorldType == EWorldType::Game || It->WorldType == EWorldType::PIE)
+			{
+				++Snap.NumWorlds;
+			}
+		}
+
+		// 이전 레벨 액터가 GC 후에도 남아 있으면 누군가 잡고 있는 것 (타이머 람다, 위젯 참조 등)
+		for (TObjectIterator<AActor> It; It; ++It)
+		{
+			if (!IsLiveInstance(*It)) continue;
+
+			const UWorld* ActorWorld = It->GetWorld();
+			if (ActorWorld && ActorWorld != World
+				&& (ActorWorld->WorldType == EWorldType::Game || ActorWorld->WorldType == EWorldType::PIE))
+			{
+				++Snap.NumStaleActors;
+			}
+		}
+
+		Snap.NumEnemies = CountLive<AEnemyCharacter>();
+		Snap.NumWidgets = CountLive<UUserWidget>();
+		Snap.NumNiagara = CountLive<UNiagaraComponent>();
+		Snap.NumStageData = CountLive<UStageData>();
+
+		return Snap;
+	}
+
+	static double ToMB(int64 Bytes)
+	{
+		return (double)Bytes / (1024.0 * 1024.0);
+	}
+
+	static void Print(const FSnapshot& Snap, FOutputDevice& Ar)
+	{
+		Ar.Logf(TEXT("===== Battle Memory: #%d %s (Difficulty %d) ====="), Snap.Sequence, *Snap.Stage.ToString(), Snap.Difficulty);
+
+		const FSnapshot& Base = bHasFirst ? First : Snap;
+		const FSnapshot& Prev = (NumSnapshots > 0) ? Previous : Snap;
+
+		if (Snap.bHasLLM)
+		{
+			Ar.Logf(TEXT("%-10s %10s %10s %12s %12s"), TEXT("Tag"), TEXT("MB"), TEXT("Budget"), TEXT("SinceFirst"), TEXT("SincePrev"));
+			for (int32 i = 0; i < (int32)EBattleMemTag::Count; ++i)
+			{
+				const double MB = ToMB(Snap.TagBytes[i]);
+				Ar.Logf(TEXT("%-10s %10.2f %10.1f %+12.2f %+12.2f%s"),
+					FBattleMemoryReport::GetTagName((EBattleMemTag)i), MB, TagBudgetMB[i],
+					MB - ToMB(Base.TagBytes[i]), MB - ToMB(Prev.TagBytes[i]),
+					MB > TagBudgetMB[i] ? TEXT("  OVER") : TEXT(""));
+			}
+		}
+		else
+		{
+			Ar.Logf(TEXT("LLM disabled (run with -llm for per-tag numbers)"));
+		}
+
+		Ar.Logf(TEXT("Physical   %10.1f MB  (SinceFirst %+.1f, SincePrev %+.1f)"),
+			ToMB(Snap.UsedPhysical), ToMB(Snap.UsedPhysical) - ToMB(Base.UsedPhysical), ToMB(Snap.UsedPhysical) - ToMB(Prev.UsedPhysical));
+
+		auto CountLine = [&Ar](const TCHAR* Label, int32 Now, int32 FirstValue, int32 PrevValue)
+		{
+			Ar.Logf(TEXT("%-12s %8d  (SinceFirst %+d, SincePrev %+d)"), Label, Now, Now - FirstValue, Now - PrevValue);
+		};
+		CountLine(TEXT("UObjects"), Snap.NumObjects, Base.NumObjects, Prev.NumObjects);
+		CountLine(TEXT("Enemies"), Snap.NumEnemies, Base.NumEnemies, Prev.NumEnemies);
+		CountLine(TEXT("Widgets"), Snap.NumWidgets, Base.NumWidgets, Prev.NumWidgets);
+		CountLine(TEXT("Niagara"), Snap.NumNiagara, Base.NumNiagara, Prev.NumNiagara);
+		CountLine(TEXT("StageData"), Snap.NumStageData, Base.NumStageData, Prev.NumStageData);
+
+		// 맵 로드 직후에는 이전 월드가 이미 정리됐어야 함
+		if (Snap.NumWorlds > 1 || Snap.NumStaleActors > 0)
+		{
+			Ar.Logf(ELogVerbosity::Warning, TEXT("Leak suspect: %d game world(s) alive, %d actor(s) from other worlds"),
+				Snap.NumWorlds, Snap.NumStaleActors);
+		}
+	}
+
+	static void Record(const FSnapshot& Snap)
+	{
+		if (!bHasFirst)
+		{
+			First = Snap;
+			bHasFirst = true;
+		}
+		Previous = Snap;
+		++NumSnapshots;
+	}
+}
+
+const TCHAR* FBattleMemoryReport::GetTagName(EBattleMemTag Tag)
+{
+	switch (Tag)
+	{
+	case EBattleMemTag::Grid:		return TEXT("Grid");
+	case EBattleMemTag::Enemies:	return TEXT("Enemies");
+	case EBattleMemTag::SkillFX:	return TEXT("SkillFX");
+	case EBattleMemTag::StageData:	return TEXT("StageData");
+	case EBattleMemTag::UI:			return TEXT("UI");
+	default:						return TEXT("Unknown");
+	}
+}
+
+void FBattleMemoryReport::OnStageTransition(UWorld* World, FName StageName, int32 Difficulty)
+{
+	using namespace BattleMemoryPrivate;
+	if (!CVarReportOnTransition.GetValueOnGameThread() || !World)
+	{
+		return;
+	}
+
+	const FSnapshot Snap = Capture(World, StageName, Difficulty);
+	Print(Snap, *GLog);
+	Record(Snap);
+}
+
+void FBattleMemoryReport::Report(UWorld* World, FOutputDevice& Ar, bool bListTimers)
+{
+	using namespace BattleMemoryPrivate;
+	if (!World)
+	{
+		return;
+	}
+
+	// 수동 리포트는 기록에 남기지 않음 (스테이지 전환 간 비교 유지)
+	const FSnapshot Snap = Capture(World, FName(*World->GetMapName()), bHasFirst ? Previous.Difficulty : 0);
+	Print(Snap, Ar);
+
+	if (bListTimers)
+	{
+		World->GetTimerManager().ListTimers();
+	}
+}
+
+void FBattleMemoryReport::ResetBaseline()
+{
+	using namespace BattleMemoryPrivate;
+	bHasFirst = false;
+	NumSnapshots = 0;
+	First = FSnapshot();
+	Previous = FSnapshot();
+}
+
+// ───────── 콘솔 명령 ─────────
+
+static FAutoConsoleCommand BattleMemoryReportCmd(
+	TEXT("Battle.Memory.Report"),
+	TEXT("메모리 예산 리포트를 출력합니다 (첫 스테이지 / 직전 스테이지 대비). -timers 를 주면 등록된 타이머 목록도 출력합니다."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const bool bListTimers = Args.ContainsByPredicate([](const FString& Arg) { return Arg.Equals(TEXT("-timers"), ESearchCase::IgnoreCase); });
+		FBattleMemoryReport::Report(World, Ar, bListTimers);
+	}));
+
+static FAutoConsoleCommand BattleMemoryResetCmd(
+	TEXT("Battle.Memory.ResetBaseline"),
+	TEXT("메모리 리포트 기준을 초기화합니다 (다음 스테이지 전환이 새 기준)."),
+	FConsoleCommandDelegate::CreateStatic(&FBattleMemoryReport::ResetBaseline));
+
+#endif
@@ -0,0 +1,285 @@
+﻿#include "BattlePhaseMonitor.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Portfolio2Game.h"
+#include "BattleManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace BattlePhaseMonitorPrivate
+{
+	static TAutoConsoleVariable<bool> CVarEnable(
+		TEXT("Battle.PhaseMonitor.Enable"),
+		false,
+		TEXT("전투 단계별 게임 스레드 비용 측정을 켜거나 끕니다."));
+
+	static TAutoConsoleVariable<float> CVarBudgetMs(
+		TEXT("Battle.PhaseMonitor.BudgetMs"),
+		8.0f,
+		TEXT("전투 단계 1회의 허용 비용(ms). 초과하면 트레이스와 보드 상태를 기록합니다."));
+
+	// 최근 단계 기록 개수 (예산 초과 시 함께 저장)
+	constexpr int32 TraceLength = 16;
+
+	// 보관할 예산 초과 기록 최대 개수 (오래된 것부터 버림)
+	constexpr int32 MaxViolations = 128;
+
+	struct FPhaseStats
+	{
+		int32 Count = 0;
+		int32 OverBudgetCount = 0;
+		double TotalMs = 0.0;
+		double MaxMs = 0.0;
+	};
+
+	static FPhaseStats Stats[(int32)EBattlePhase::Count];
+	static FBattlePhaseSample Trace[TraceLength];
+	static int32 TraceHead = 0;
+	static int32 TraceNum = 0;
+	static TArray<FBattlePhaseViolation> Violations;
+
+	// 현재 열려 있는 가장 안쪽 단계 (중첩 시 자기 시간 계산용)
+	static FScopedBattlePhase* InnermostScope = nullptr;
+
+	static FString FormatTrace(const TArray<FBattlePhaseSample>& Samples, const TCHAR* Separator)
+	{
+		FString Out;
+		for (const FBattlePhaseSample& S : Samples)
+		{
+			if (!Out.IsEmpty()) Out += Separator;
+			Out += FString::Printf(TEXT("[F%llu] %s %.2fms (incl %.2fms) %s"),
+				S.Frame, FBattlePhaseMonitor::GetPhaseName(S.Phase), S.Ms, S.InclusiveMs, *S.Context.ToString());
+		}
+		return Out;
+	}
+}
+
+bool FBattlePhaseMonitor::IsEnabled()
+{
+	return BattlePhaseMonitorPrivate::CVarEnable.GetValueOnGameThread();
+}
+
+double FBattlePhaseMonitor::GetBudgetMs()
+{
+	return (double)BattlePhaseMonitorPrivate::CVarBudgetMs.GetValueOnGameThread();
+}
+
+void FBattlePhaseMonitor::Report(EBattlePhase Phase, double SelfMs, double InclusiveMs, const ABattleManager* Manager, const UObject* Context)
+{
+	using namespace BattlePhaseMonitorPrivate;
+
+	const double Ms = SelfMs;
+
+	FBattlePhaseSample Sample;
+	Sample.Phase = Phase;
+	Sample.Ms = SelfMs;
+	Sample.InclusiveMs = InclusiveMs;
+	Sample.Frame = GFrameCounter;
+	Sample.Context = Context ? Context->GetFName() : NAME_None;
+
+	FPhaseStats& PhaseStats = Stats[(int32)Phase];
+	PhaseStats.Count++;
+	PhaseStats.TotalMs += Ms;
+	PhaseStats.MaxMs = FMath::Max(PhaseStats.MaxMs, Ms);
+
+	const double BudgetMs = GetBudgetMs();
+	if (Ms > BudgetMs)
+	{
+		PhaseStats.OverBudgetCount++;
+
+		FBattlePhaseViolation Violation;
+		Violation.Sample = Sample;
+		Violation.BudgetMs = BudgetMs;
+		Violation.Time = FDateTime::Now();
+
+		// 링 버퍼 -> 오래된 순 배열
+		Violation.RecentTrace.Reserve(TraceNum);
+		for (int32 i = 0; i < TraceNum; ++i)
+		{
+			const int32 Idx = (TraceHead - TraceNum + i + TraceLength) % TraceLength;
+			Violation.RecentTrace.Add(Trace[Idx]);
+		}
+
+		if (Manager)
+		{
+			Violation.Turn = Manager->TurnCount;
+			Violation.Round = Manager->CurrentRound;
+			Violation.BoardState = Manager->DescribeBoardState();
+		}
+
+		UE_LOG(LogBattle, Warning, TEXT("[PhaseMonitor] %s took %.2fms self / %.2fms incl (budget %.2fms) Turn %d Round %d %s\n  Trace: %s\n%s"),
+			GetPhaseName(Phase), Ms, InclusiveMs, BudgetMs, Violation.Turn, Violation.Round, *Sample.Context.ToString(),
+			*FormatTrace(Violation.RecentTrace, TEXT("\n         ")), *Violation.BoardState);
+
+		if (Violations.Num() >= MaxViolations)
+		{
+			Violations.RemoveAt(0);
+		}
+		Violations.Add(MoveTemp(Violation));
+	}
+
+	Trace[TraceHead] = Sample;
+	TraceHead = (TraceHead + 1) % TraceLength;
+	TraceNum = FMath::Min(TraceNum + 1, TraceLength);
+}
+
+const TArray<FBattlePhaseViolation>& FBattlePhaseMonitor::GetViolations()
+{
+	return BattlePhaseMonitorPrivate::Violations;
+}
+
+void FBattlePhaseMonitor::Dump(FOutputDevice& Ar)
+{
+	using namespace BattlePhaseMonitorPrivate;
+
+	Ar.Logf(TEXT("===== Battle Phase Monitor (Budget %.2fms, self time) ====="), GetBudgetMs());
+	for (int32 i = 0; i < (int32)EBattlePhase::Count; ++i)
+	{
+		const FPhaseStats& S = Stats[i];
+		const double AvgMs = (S.Count > 0) ? (S.TotalMs / S.Count) : 0.0;
+		Ar.Logf(TEXT("%-16s Count %5d  Avg %6.2fms  Max %6.2fms  Over %d"),
+			GetPhaseName((EBattlePhase)i), S.Count, AvgMs, S.MaxMs, S.OverBudgetCount);
+	}
+
+	Ar.Logf(TEXT("----- Violations (%d) -----"), Violations.Num());
+	for (const FBattlePhaseViolation& V : Violations)
+	{
+		Ar.Logf(TEXT("%s [F%llu] %s %.2fms Turn %d Round %d %s"),
+			*V.Time.ToString(), V.Sample.Frame, GetPhaseName(V.Sample.Phase), V.Sample.Ms,
+			V.Turn, V.Round, *V.Sample.Context.ToString());
+	}
+}
+
+bool FBattlePhaseMonitor::ExportCSV(const FString& FilePath)
+{
+	using namespace BattlePhaseMonitorPrivate;
+
+	// CSV 한 칸에 들어가도록 줄바꿈/따옴표 정리
+	auto Escape = [](const FString& In)
+	{
+		FString Out = In.Replace(TEXT("\""), TEXT("\"\""));
+		Out.ReplaceInline(TEXT("\n"), TEXT(" | "));
+		return FString::Printf(TEXT("\"%s\""), *Out);
+	};
+
+	FString Csv = TEXT("Time,Frame,Phase,Ms,InclusiveMs,BudgetMs,Turn,Round,Context,Trace,BoardState\n");
+	for (const FBattlePhaseViolation& V : Violations)
+	{
+		Csv += FString::Printf(TEXT("%s,%llu,%s,%.3f,%.3f,%.3f,%d,%d,%s,%s,%s\n"),
+			*V.Time.ToString(), V.Sample.Frame, GetPhaseName(V.Sample.Phase), V.Sample.Ms, V.Sample.InclusiveMs, V.BudgetMs,
+			V.Turn, V.Round, *V.Sample.Context.ToString(),
+			*Escape(FormatTrace(V.RecentTrace, TEXT("\n"))), *Escape(V.BoardState));
+	}
+
+	return FFileHelper::SaveStringToFile(Csv, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8);
+}
+
+void FBattlePhaseMonitor::Reset()
+{
+	using namespace BattlePhaseMonitorPrivate;
+
+	for (FPhaseStats& S : Stats)
+	{
+		S = FPhaseStats();
+	}
+	TraceHead = 0;
+	TraceNum = 0;
+	Violations.Reset();
+}
+
+const TCHAR* FBattlePhaseMonitor::GetPhaseName(EBattlePhase Phase)
+{
+	switch (Phase)
+	{
+	case EBattlePhase::PlayerInput:		return TEXT("PlayerInput");
+	case EBattlePhase::EnemyPlanning:	return TEXT("EnemyPlanning");
+	case EBattlePhase::EnemyAction:		return TEXT("EnemyAction");
+	case EBattlePhase::SkillResolution:	return TEXT("SkillResolution");
+	case EBattlePhase::RoundSpawn:		return TEXT("RoundSpawn");
+	case EBattlePhase::LevelTransition:	return TEXT("LevelTransition");
+	default:							return TEXT("Unknown");
+	}
+}
+
+// ───────── 범위 측정 ─────────
+
+FScopedBattlePhase::FScopedBattlePhase(EBattlePhase InPhase, const ABattleManager* InManager, const UObject* InContext)
+	: Phase(InPhase)
+	, Manager(InManager)
+	, Context(InContext)
+	, StartCycles(FBattlePhaseMonitor::IsEnabled() ? FPlatformTime::Cycles64() : 0)
+{
+	if (StartCycles != 0 && IsInGameThread())
+	{
+		Parent = BattlePhaseMonitorPrivate::InnermostScope;
+		BattlePhaseMonitorPrivate::InnermostScope = this;
+	}
+}
+
+FScopedBattlePhase::~FScopedBattlePhase()
+{
+	if (StartCycles == 0)
+	{
+		return;
+	}
+
+	const uint64 Elapsed = FPlatformTime::Cycles64() - StartCycles;
+
+	// 스택에서 빠지면서 바깥 단계에 내 전체 시간을 넘김 (바깥은 이 시간을 자기 시간에서 뺌)
+	if (BattlePhaseMonitorPrivate::InnermostScope == this)
+	{
+		BattlePhaseMonitorPrivate::InnermostScope = Parent;
+		if (Parent)
+		{
+			Parent->ChildCycles += Elapsed;
+		}
+	}
+
+	// 측정 중간에 꺼졌으면 무시
+	if (!FBattlePhaseMonitor::IsEnabled())
+	{
+		return;
+	}
+
+	const double InclusiveMs = FPlatformTime::ToMilliseconds64(Elapsed);
+	const double SelfMs = FPlatformTime::ToMilliseconds64(Elapsed - FMath::Min(ChildCycles, Elapsed));
+	FBattlePhaseMonitor::Report(Phase, SelfMs, InclusiveMs, Manager, Context);
+}
+
+// ───────── 콘솔 명령 ─────────
+
+static FAutoConsoleCommand BattlePhaseDumpCmd(
+	TEXT("Battle.PhaseMonitor.Dump"),
+	TEXT("전투 단계별 비용 통계와 예산 초과 기록을 출력합니다."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		FBattlePhaseMonitor::Dump(Ar);
+	}));
+
+static FAutoConsoleCommand BattlePhaseExportCmd(
+	TEXT("Battle.PhaseMonitor.ExportCSV"),
+	TEXT("예산 초과 기록을 CSV로 저장합니다. 인자가 없으면 Saved/Profiling/BattlePhase-<시각>.csv"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FString FilePath = (Args.Num() > 0)
+			? Args[0]
+			: FPaths::ProfilingDir() / FString::Printf(TEXT("BattlePhase-%s.csv"), *FDateTime::Now().ToString());
+
+		if (FBattlePhaseMonitor::ExportCSV(FilePath))
+		{
+			UE_LOG(LogBattle, Log, TEXT("[PhaseMonitor] Exported %d violation(s) -> %s"), FBattlePhaseMonitor::GetViolations().Num(), *FilePath);
+		}
+		else
+		{
+			UE_LOG(LogBattle, Error, TEXT("[PhaseMonitor] CSV export failed: %s"), *FilePath);
+		}
+	}));
+
+static FAutoConsoleCommand BattlePhaseResetCmd(
+	TEXT("Battle.PhaseMonitor.Reset"),
+	TEXT("전투 단계 통계와 예산 초과 기록을 초기화합니다."),
+	FConsoleCommandDelegate::CreateStatic(&FBattlePhaseMonitor::Reset));
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,252 @@
+﻿#include "BattleUILayerSubsystem.h"
+#include "Portfolio2Game.h"
+#include "BattleMemoryReport.h"
+#include "Blueprint/UserWidget.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "PortfolioGameInstance.h"
+#include "Misc/PackageName.h"
+#include "TimerManager.h"
+#include "UObject/UObjectGlobals.h"
+#include <Misc/OutputDeviceNull.h>
+
+UBattleUILayerSubsystem* UBattleUILayerSubsystem::Get(const UObject* WorldContextObject)
+{
+	UGameInstance* GI = UGameplayStatics::GetGameInstance(WorldContextObject);
+	return GI ? GI->GetSubsystem<UBattleUILayerSubsystem>() : nullptr;
+}
+
+void UBattleUILayerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LayerWidgets.SetNum((int32)EBattleUILayer::Count);
+
+	FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &UBattleUILayerSubsystem::HandlePreLoadMap);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &UBattleUILayerSubsystem::HandlePostLoadMap);
+}
+
+void UBattleUILayerSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::PreLoadMap.RemoveAll(this);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.RemoveAll(this);
+
+	for (int32 i = 0; i < (int32)EBattleUILayer::Count; ++i)
+	{
+		ResetLayer((EBattleUILayer)i);
+	}
+
+	Super::Deinitialize();
+}
+
+int32 UBattleUILayerSubsystem::GetZOrder(EBattleUILayer Layer)
+{
+	switch (Layer)
+	{
+	case EBattleUILayer::TopBar:		return 9000;
+	case EBattleUILayer::BattleStart:	return 9998;
+	case EBattleUILayer::Transition:	return 9999; // 항상 최상단
+	default:							return 0;
+	}
+}
+
+UUserWidget* UBattleUILayerSubsystem::ShowLayer(EBattleUILayer Layer, TSubclassOf<UUserWidget> WidgetClass, bool* bOutCreated)
+{
+	if (bOutCreated) *bOutCreated = false;
+	if (!WidgetClass || Layer >= EBattleUILayer::Count) return nullptr;
+
+	const int32 Idx = (int32)Layer;
+
+	// 다른 클래스를 요청하면 교체 (맵마다 다른 위젯을 쓰는 경우)
+	if (LayerWidgets[Idx] && LayerWidgets[Idx]->GetClass() != WidgetClass)
+	{
+		ResetLayer(Layer);
+	}
+
+	if (!LayerWidgets[Idx])
+	{
+		// 월드가 아니라 GameInstance 소유로 생성해야 레벨 이동 후에도 살아남음
+		BATTLE_LLM_SCOPE(UI);
+		LayerWidgets[Idx] = CreateWidget<UUserWidget>(GetGameInstance(), WidgetClass);
+		if (!LayerWidgets[Idx]) return nullptr;
+
+		if (bOutCreated) *bOutCreated = true;
+	}
+
+	AttachToViewport(Layer);
+	return LayerWidgets[Idx];
+}
+
+void UBattleUILayerSubsystem::HideLayer(EBattleUILayer Layer)
+{
+	if (Layer >= EBattleUILayer::Count) return;
+
+	const int32 Idx = (int32)Layer;
+	if (UUserWidget* Widget = LayerWidgets[Idx])
+	{
+		Widget->RemoveFromParent();
+	}
+	bRestoreAfterLoad[Idx] = false;
+
+	if (Layer == EBattleUILayer::Transition)
+	{
+		bCovered = false;
+	}
+}
+
+UUserWidget* UBattleUILayerSubsystem::GetLayerWidget(EBattleUILayer Layer) const
+{
+	return Layer < EBattleUILayer::Count ? LayerWidgets[(int32)Layer].Get() : nullptr;
+}
+
+void UBattleUILayerSubsystem::AttachToViewport(EBattleUILayer Layer)
+{
+	const int32 Idx = (int32)Layer;
+	UUserWidget* Widget = LayerWidgets[Idx];
+	if (!Widget) return;
+
+	if (!Widget->IsInViewport())
+	{
+		// Slate 트리를 붙잡고 있으면 TakeWidget이 기존 트리를 그대로 반환 (재구성/Construct 없음)
+		Widget->AddToViewport(GetZOrder(Layer));
+	}
+	SlateRoots[Idx] = Widget->TakeWidget();
+}
+
+void UBattleUILayerSubsystem::ResetLayer(EBattleUILayer Layer)
+{
+	if (Layer >= EBattleUILayer::Count) return;
+
+	const int32 Idx = (int32)Layer;
+	if (UUserWidget* Widget = LayerWidgets[Idx])
+	{
+		Widget->RemoveFromParent();
+	}
+	LayerWidgets[Idx] = nullptr;
+	SlateRoots[Idx].Reset();
+	bRestoreAfterLoad[Idx] = false;
+
+	if (Layer == EBattleUILayer::Transition)
+	{
+		bCovered = false;
+	}
+}
+
+// ───────── 전환 연출 ─────────
+
+void UBattleUILayerSubsystem::PlayCover(TSubclassOf<UUserWidget> TransitionClass)
+{
+	UUserWidget* Widget = ShowLayer(EBattleUILayer::Transition, TransitionClass);
+	if (!Widget) return;
+
+	// 직전 걷기의 숨김 예약 취소 (덮는 도중 떼어내지 않도록)
+	GetGameInstance()->GetTimerManager().ClearTimer(UncoverHideHandle);
+
+	FOutputDeviceNull Ar;
+	Widget->CallFunctionByNameWithArguments(TEXT("PlayCover"), Ar, nullptr, true);
+	bCovered = true;
+}
+
+void UBattleUILayerSubsystem::EnsureCovered(TSubclassOf<UUserWidget> TransitionClass)
+{
+	const int32 Idx = (int32)EBattleUILayer::Transition;
+
+	// 이전 레벨에서 덮은 채로 넘어옴: 같은 인스턴스가 덮인 상태 그대로 이어짐
+	if (bCovered && LayerWidgets[Idx] && LayerWidgets[Idx]->GetClass() == TransitionClass)
+	{
+		AttachToViewport(EBattleUILayer::Transition);
+		return;
+	}
+
+	// 걷힌 뒤의 인스턴스는 마지막 프레임(투명) 상태이므로 덮인 모습의 새 위젯으로 교체
+	ResetLayer(EBattleUILayer::Transition);
+	if (ShowLayer(EBattleUILayer::Transition, TransitionClass))
+	{
+		bCovered = true;
+	}
+}
+
+void UBattleUILayerSubsystem::PlayUncover(float HideDelay)
+{
+	UUserWidget* Widget = LayerWidgets[(int32)EBattleUILayer::Transition];
+	if (!Widget || !bCovered) return;
+
+	FOutputDeviceNull Ar;
+	Widget->CallFunctionByNameWithArguments(TEXT("PlayUncover"), Ar, nullptr, true);
+	bCovered = false;
+
+	// 걷기 연출이 끝나면 뷰포트에서만 떼어냄 (다음 덮기에 재사용)
+	GetGameInstance()->GetTimerManager().SetTimer(UncoverHideHandle, FTimerDelegate::CreateWeakLambda(this, [this]()
+		{
+			if (!bCovered)
+			{
+				HideLayer(EBattleUILayer::Transition);
+			}
+		}), FMath::Max(HideDelay, KINDA_SMALL_NUMBER), false);
+}
+
+void UBattleUILayerSubsystem::ResetAllLayers()
+{
+	GetGameInstance()->GetTimerManager().ClearTimer(UncoverHideHandle);
+
+	for (int32 i = 0; i < (int32)EBattleUILayer::Count; ++i)
+	{
+		ResetLayer((EBattleUILayer)i);
+	}
+}
+
+// ───────── 레벨 이동 ─────────
+
+bool UBattleUILayerSubsystem::IsStageFlowMap(const UWorld* World) const
+{
+	const UPortfolioGameInstance* GI = Cast<UPortfolioGameInstance>(GetGameInstance());
+	if (!GI || !World) return false;
+
+	// StageList는 짧은 이름(AA) 또는 전체 경로로 적혀 있음 (PIE 접두사는 제거해서 비교)
+	const FString MapName = UWorld::RemovePIEPrefix(World->GetOutermost()->GetName());
+	const FName LongName(*MapName);
+	const FName ShortName(*FPackageName::GetShortName(MapName));
+
+	return GI->StageList.Contains(LongName) || GI->StageList.Contains(ShortName);
+}
+
+void UBattleUILayerSubsystem::HandlePreLoadMap(const FString& MapName)
+{
+	// 월드 정리 때 엔진이 위젯을 뷰포트에서 떼어내므로, 그 전에 붙어 있던 레이어를 기록
+	for (int32 i = 0; i < (int32)EBattleUILayer::Count; ++i)
+	{
+		bRestoreAfterLoad[i] = LayerWidgets[i] && LayerWidgets[i]->IsInViewport();
+	}
+}
+
+void UBattleUILayerSubsystem::HandlePostLoadMap(UWorld* LoadedWorld)
+{
+	if (!LoadedWorld || LoadedWorld->GetGameInstance() != GetGameInstance()) return;
+
+	// 메인 화면 / 로딩 맵 등: 상단 바나 덮개를 걷어줄 매니저가 없으므로 붙이지 않고 버림
+	if (!IsStageFlowMap(LoadedWorld))
+	{
+		ResetAllLayers();
+		UE_LOG(LogBattle, Log, TEXT("[UILayer] %s is outside the stage flow, persistent layers cleared"), *LoadedWorld->GetMapName());
+		return;
+	}
+
+	// 새 월드의 첫 프레임 전에 다시 붙여서 덮인 화면이 끊기지 않게 함
+	int32 NumRestored = 0;
+	for (int32 i = 0; i < (int32)EBattleUILayer::Count; ++i)
+	{
+		if (!bRestoreAfterLoad[i] || !LayerWidgets[i]) continue;
+		bRestoreAfterLoad[i] = false;
+
+		AttachToViewport((EBattleUILayer)i);
+
+		// 위젯 BP가 새 월드의 액터를 다시 찾을 기회 (함수가 없으면 무시됨)
+		FOutputDeviceNull Ar;
+		LayerWidgets[i]->CallFunctionByNameWithArguments(TEXT("OnUILayerRebound"), Ar, nullptr, true);
+		++NumRestored;
+	}
+
+	UE_LOG(LogBattle, Log, TEXT("[UILayer] Rebound %d persistent layer(s) to %s (Covered: %s)"),
+		NumRestored, *LoadedWorld->GetMapName(), bCovered ? TEXT("Yes") : TEXT("No"));
+}
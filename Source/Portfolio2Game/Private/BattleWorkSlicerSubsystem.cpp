@@ -0,0 +1,120 @@
+﻿#include "BattleWorkSlicerSubsystem.h"
+#include "Portfolio2Game.h"
+#include "HAL/IConsoleManager.h"
+
+namespace BattleWorkSlicerPrivate
+{
+	static TAutoConsoleVariable<bool> CVarEnable(
+		TEXT("Battle.WorkSlicer.Enable"),
+		true,
+		TEXT("턴/라운드 시작 작업을 여러 프레임에 나눠 실행합니다. 끄면 등록 즉시 전부 실행합니다."));
+
+	static TAutoConsoleVariable<float> CVarBudgetMs(
+		TEXT("Battle.WorkSlicer.BudgetMs"),
+		2.0f,
+		TEXT("작업 분할기가 한 프레임에 쓸 수 있는 게임 스레드 시간(ms)."));
+}
+
+void UBattleWorkSlicerSubsystem::Enqueue(FName Label, int32 NumItems, TFunction<void(int32)> ItemFn, TFunction<void()> OnComplete)
+{
+	FWorkBatch& Batch = Batches.AddDefaulted_GetRef();
+	Batch.Label = Label;
+	Batch.NumItems = ItemFn ? FMath::Max(NumItems, 0) : 0;
+	Batch.StartFrame = (int32)(GFrameCounter & MAX_int32);
+	Batch.ItemFn = MoveTemp(ItemFn);
+	Batch.OnComplete = MoveTemp(OnComplete);
+
+	// 실행 중에 등록된 배치(완료 콜백에서 이어 붙인 작업 등)는 현재 Pump가 이어서 처리
+	if (!bPumping)
+	{
+		Pump(!BattleWorkSlicerPrivate::CVarEnable.GetValueOnGameThread());
+	}
+}
+
+void UBattleWorkSlicerSubsystem::Flush()
+{
+	if (!bPumping)
+	{
+		Pump(true);
+	}
+}
+
+void UBattleWorkSlicerSubsystem::Pump(bool bIgnoreBudget)
+{
+	TGuardValue<bool> PumpGuard(bPumping, true);
+
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		UsedMsThisFrame = 0.0;
+	}
+
+	const double BudgetMs = BattleWorkSlicerPrivate::CVarBudgetMs.GetValueOnGameThread();
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	bool bRanItem = false;
+
+	auto OverBudget = [&]()
+	{
+		if (bIgnoreBudget || !bRanItem) return false; // 최소 1항목은 진행 (무한 대기 방지)
+		const double Ms = UsedMsThisFrame + FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		return Ms >= BudgetMs;
+	};
+
+	while (Batches.Num() > 0 && !OverBudget())
+	{
+		// 항목 실행 중 새 배치가 추가되면 배열이 재할당될 수 있으므로 매번 인덱스로 접근
+		if (Batches[0].NextItem < Batches[0].NumItems)
+		{
+			const int32 Item = Batches[0].NextItem++;
+			Batches[0].ItemFn(Item);
+			bRanItem = true;
+			continue;
+		}
+
+		// 배치 완료: 먼저 목록에서 빼고 콜백 (콜백이 새 배치를 등록해도 순서 유지)
+		FWorkBatch Done = MoveTemp(Batches[0]);
+		Batches.RemoveAt(0, 1, false);
+
+		const int32 Frames = (int32)(GFrameCounter & MAX_int32) - Done.StartFrame + 1;
+		if (Frames > 1)
+		{
+			UE_LOG(LogBattle, Verbose, TEXT("[WorkSlicer] %s: %d item(s) over %d frame(s)"), *Done.Label.ToString(), Done.NumItems, Frames);
+		}
+
+		if (Done.OnComplete)
+		{
+			Done.OnComplete();
+			bRanItem = true;
+		}
+	}
+
+	UsedMsThisFrame += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+}
+
+void UBattleWorkSlicerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bPumping)
+	{
+		Pump(!BattleWorkSlicerPrivate::CVarEnable.GetValueOnGameThread());
+	}
+}
+
+bool UBattleWorkSlicerSubsystem::IsTickable() const
+{
+	return Batches.Num() > 0;
+}
+
+TStatId UBattleWorkSlicerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBattleWorkSlicerSubsystem, STATGROUP_Tickables);
+}
+
+void UBattleWorkSlicerSubsystem::Deinitialize()
+{
+	// 월드가 내려가는 중이므로 남은 작업은 실행하지 않고 버림
+	Batches.Empty();
+
+	Super::Deinitialize();
+}
@@ -1,30 +1,85 @@
 ﻿// CharacterBase.cpp
 
 #include "CharacterBase.h"
+#include "Portfolio2Game.h"
 #include "GameplayAbilitySpec.h"
 #include "BattleManager.h"      
 #include "GridDataInterface.h"
 #include "Components/WidgetComponent.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "PlayerCharacter.h" 
-#include "GameFramework/CharacterMovementComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
 #include "Kismet/GameplayStatics.h" 
 #include "GridISM.h"
 #include "GA_Move.h"
+#include "PortfolioGameInstance.h"
+#include "GridMotionSubsystem.h"
+#include "InputLatencyTracer.h"
+#include "BattleGCSubsystem.h"
+#include "CombatEventBusSubsystem.h"
+#include "HAL/IConsoleManager.h"
+
+namespace UnitAnimBudget
+{
+	static TAutoConsoleVariable<bool> CVarEnable(
+		TEXT("Battle.Anim.Budget"),
+		true,
+		TEXT("대기 중인 유닛의 애니메이션 평가 빈도를 낮춥니다. 행동 중인 유닛은 항상 매 프레임."));
+
+	static TAutoConsoleVariable<float> CVarIdleTickInterval(
+		TEXT("Battle.Anim.IdleTickInterval"),
+		1.0f / 15.0f,
+		TEXT("대기 유닛 메시의 평가 간격(초)."));
+
+	static TAutoConsoleVariable<float> CVarActingHoldSeconds(
+		TEXT("Battle.Anim.ActingHoldSeconds"),
+		1.5f,
+		TEXT("EndAction 후에도 풀 레이트를 유지할 시간(초). 턴을 넘긴 뒤 재생되는 공격/정지 몽타주용."));
+}
 
-ACharacterBase::ACharacterBase()
+ACharacterBase::ACharacterBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.DoNotCreateDefaultSubobject(ACharacter::CharacterMovementComponentName))
 {
+	// 이동 보간은 UGridMotionSubsystem이 일괄 처리하므로 유닛 Tick은 기본 꺼둠
+	// (BP에서 Tick이 필요하면 SetActorTickEnabled로 켤 수 있도록 bCanEverTick은 유지)
 	PrimaryActorTick.bCanEverTick = true;
-	PrimaryActorTick.bStartWithTickEnabled = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
 	AbilitySystem = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystem"));
 	Attributes = CreateDefaultSubobject<UBaseAttributeSet>(TEXT("Attributes"));
+
+	// 캡슐은 선택/트레이스용 프록시로만 사용 (물리/겹침 갱신 없음)
+	// 이동 보간의 SetActorLocation이 매 프레임 오버랩 검사를 하지 않도록 겹침 이벤트도 끔
+	if (UCapsuleComponent* Capsule = GetCapsuleComponent())
+	{
+		Capsule->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		Capsule->SetGenerateOverlapEvents(false);
+		Capsule->SetCanEverAffectNavigation(false);
+	}
+	if (GetMesh())
+	{
+		GetMesh()->SetGenerateOverlapEvents(false);
+
+		// 화면 밖이면 포즈는 건너뛰고 몽타주 시간(노티파이/섹션 진행)만 진행
+		GetMesh()->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+	}
 }
 
 void ACharacterBase::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// 즉시 판정 모드면 연출(애니메이션/이동)을 배속 재생
+	if (UPortfolioGameInstance* GI = Cast<UPortfolioGameInstance>(GetGameInstance()))
+	{
+		CustomTimeDilation = GI->GetVisualTimeDilation();
+	}
+
+	// 행동 전까지는 대기 유닛 예산으로 평가
+	ApplyIdleAnimBudget();
+
 	BattleManagerRef = Cast<ABattleManager>(
 		UGameplayStatics::GetActorOfClass(GetWorld(), ABattleManager::StaticClass()));
 
@@ -57,19 +112,18 @@ void ACharacterBase::BeginPlay()
 		AGridISM* Grid = Cast<AGridISM>(BattleManagerRef->GridActorRef);
 		if (Grid && Attributes)
 		{
-			int32 Cur = FMath::RoundToInt(Attributes->GetHealth_BP());
-			int32 Max = FMath::RoundToInt(Attributes->GetMaxHealth_BP());
+			// 풀 예열로 스폰된 적은 아직 보드에 없으므로 HP바를 켜지 않음 (풀에서 꺼낼 때 켬)
+			if (IsOnBoard())
+			{
+				int32 Cur = FMath::RoundToInt(Attributes->GetHealth_BP());
+				int32 Max = FMath::RoundToInt(Attributes->GetMaxHealth_BP());
 
-			// 현재 칸(GridIndex)의 HP바 켜기
-			Grid->UpdateTileHPBar(GridIndex, true, Cur, Max);
+				// 현재 칸(GridIndex)의 HP바 켜기
+				Grid->UpdateTileHPBar(GridIndex, true, Cur, Max);
 
-			// 위치 기억
-			CachedGridIndex = GridIndex;
-
-			// 델리게이트 연결 (HP 변할 때 갱신용)
-			FScriptDelegate Delegate;
-			Delegate.BindUFunction(this, FName("OnHealthChanged_Wrapper")); // 아래 4번에서 만들 함수
-			OnHealthChanged.Add(Delegate);
+				// 위치 기억
+				CachedGridIndex = GridIndex;
+			}
 		}
 	}
 
@@ -156,6 +210,22 @@ void ACharacterBase::GiveMoveAbilities()
 
 // 회전
 
+FIntPoint ACharacterBase::RotatePatternOffset(const FIntPoint& PatternPoint, EGridDirection Facing)
+{
+	// Point.X = 전방 거리, Point.Y = 우측 거리 (Y축 반전으로 좌표계 통일)
+	const int32 P_X = PatternPoint.X;
+	const int32 P_Y = -PatternPoint.Y;
+
+	switch (Facing)
+	{
+	case EGridDirection::Right: return FIntPoint(P_X, P_Y);		// X+
+	case EGridDirection::Left:  return FIntPoint(-P_X, -P_Y);	// X-
+	case EGridDirection::Down:  return FIntPoint(-P_Y, P_X);	// Y+
+	case EGridDirection::Up:    return FIntPoint(P_Y, -P_X);	// Y-
+	}
+	return FIntPoint::ZeroValue;
+}
+
 FRotator ACharacterBase::GetRotationFromEnum(EGridDirection Dir) const
 {
 	// 언리얼 월드 좌표계 기준 (X가 전방일 때)
@@ -177,20 +247,36 @@ void ACharacterBase::RequestRotation(EGridDirection NewDir, UAnimMontage* Montag
 	FacingDirection = NewDir;
 	bIsRotating = true;
 	OnBusyStateChanged.Broadcast(true);
+	OnGridStateChanged();
+
+	if (IsPlayerControlled())
+	{
+		FInputLatencyTracer::Mark(EInputLatencyStage::Commit);
+	}
+	UCombatEventBusSubsystem::Publish(this, ECombatEventType::Rotate, this, nullptr, GridCoord, (int32)NewDir);
+
+	// 즉시 판정 모드: 회전 몽타주 없이 바로 확정
+	if (UPortfolioGameInstance::IsInstantResolve(this))
+	{
+		MontageToPlay = nullptr;
+	}
 
 	// 목표 각도 계산해두기
 	RotationStartQuat = GetActorQuat();
 	RotationTargetQuat = GetRotationFromEnum(NewDir).Quaternion();
 
-	// 방해꾼 끄기
+	// 방해꾼 끄기 (CharacterMovementComponent는 만들지 않으므로 이동 방향 회전은 없음)
 	bUseControllerRotationYaw = false;
-	if (GetCharacterMovement()) GetCharacterMovement()->bOrientRotationToMovement = false;
 	if (GetMesh()->GetAnimInstance()) GetMesh()->GetAnimInstance()->SetRootMotionMode(ERootMotionMode::IgnoreRootMotion);
 
 	// 애니메이션 재생
 	if (MontageToPlay)
 	{
 		PlayAnimMontage(MontageToPlay, 2.0f);
+		if (IsPlayerControlled())
+		{
+			FInputLatencyTracer::Mark(EInputLatencyStage::VisualStart);
+		}
 
 		// 종료 델리게이트 (안전장치)
 		FOnMontageEnded EndDelegate;
@@ -207,6 +293,10 @@ void ACharacterBase::FinalizeRotation(UAnimMontage* Montage, bool bInterrupted)
 {
 	bIsRotationWindowActive = false;
 	SetActorRotation(GetRotationFromEnum(PendingRotationDirection));
+	if (IsPlayerControlled())
+	{
+		FInputLatencyTracer::Mark(EInputLatencyStage::FirstMotion); // 몽타주 없는 회전은 여기서 처음 돌아감
+	}
 	if (GetMesh() && GetMesh()->GetAnimInstance())
 	{
 		GetMesh()->GetAnimInstance()->SetRootMotionMode(ERootMotionMode::RootMotionFromMontagesOnly);
@@ -221,6 +311,7 @@ void ACharacterBase::RotateToDirection(EGridDirection NewDir, bool bConsumeTurn)
 	// 외부에서 강제로 돌릴 때(초기화 등)를 위해 남겨둠
 	FacingDirection = NewDir;
 	SetActorRotation(GetRotationFromEnum(FacingDirection));
+	OnGridStateChanged();
 
 	if (bConsumeTurn) EndAction();
 }
@@ -231,12 +322,23 @@ void ACharacterBase::RotateToDirection(EGridDirection NewDir, bool bConsumeTurn)
 
 void ACharacterBase::StartAction()
 {
+	HoldFullRateAnim();
 	bCanAct = true;
 	OnBusyStateChanged.Broadcast(false);
+
+	// 적은 턴을 받자마자 행동 재생 (플레이어는 명령 실행 시점부터, 입력 대기는 GC 가능 구간)
+	if (!IsPlayerControlled())
+	{
+		UBattleGCSubsystem::BeginActionPlayback(this);
+	}
 }
 
 void ACharacterBase::EndAction()
 {
+	// 턴을 넘긴 뒤에도 공격/정지 몽타주가 남아 있으므로 잠시 풀 레이트 유지
+	bAnimFullRateHeld = false;
+	RequestFullRateAnim(UnitAnimBudget::CVarActingHoldSeconds.GetValueOnGameThread());
+	UBattleGCSubsystem::EndActionPlayback(this, UnitAnimBudget::CVarActingHoldSeconds.GetValueOnGameThread());
 	bCanAct = false;
 	OnBusyStateChanged.Broadcast(true);
 	if (BattleManagerRef)
@@ -245,6 +347,43 @@ void ACharacterBase::EndAction()
 	}
 }
 
+// ───────── 애니메이션 예산 ─────────
+
+void ACharacterBase::HoldFullRateAnim()
+{
+	if (!GetMesh()) return;
+
+	GetMesh()->SetComponentTickInterval(0.0f);
+	bAnimFullRateHeld = true;
+	GetWorldTimerManager().ClearTimer(AnimBudgetTimerHandle);
+}
+
+void ACharacterBase::RequestFullRateAnim(float HoldSeconds)
+{
+	// 길이 0 = 몽타주 재생 실패 / 섹션 없음 -> 풀 레이트로 올릴 이유가 없음
+	// (예전처럼 무기한 유지로 해석하면 죽은/풀에 들어간 적이 영영 풀 레이트로 남음)
+	if (!GetMesh() || HoldSeconds <= 0.0f) return;
+
+	GetMesh()->SetComponentTickInterval(0.0f);
+
+	// 이미 더 길게 잡혀 있으면 유지
+	if (bAnimFullRateHeld || GetWorldTimerManager().GetTimerRemaining(AnimBudgetTimerHandle) >= HoldSeconds)
+	{
+		return;
+	}
+	GetWorldTimerManager().SetTimer(AnimBudgetTimerHandle, this, &ACharacterBase::ApplyIdleAnimBudget, HoldSeconds, false);
+}
+
+void ACharacterBase::ApplyIdleAnimBudget()
+{
+	if (!GetMesh() || bAnimFullRateHeld) return;
+
+	const float Interval = UnitAnimBudget::CVarEnable.GetValueOnGameThread()
+		? FMath::Max(0.0f, UnitAnimBudget::CVarIdleTickInterval.GetValueOnGameThread())
+		: 0.0f;
+	GetMesh()->SetComponentTickInterval(Interval);
+}
+
 // ───────── 스킬 큐 ─────────
 
 void ACharacterBase::EnqueueSkill(TSubclassOf<UGameplayAbility> SkillClass)
@@ -279,7 +418,20 @@ void ACharacterBase::MoveToCell(FIntPoint TargetCoord, int32 TargetIndex)
 	// 2. 논리적 좌표 갱신 (이건 즉시 바뀜)
 	GridCoord = TargetCoord;
 	GridIndex = TargetIndex;
+	OnGridStateChanged();
 
+	if (IsPlayerControlled())
+	{
+		FInputLatencyTracer::Mark(EInputLatencyStage::Commit);
+	}
+	UCombatEventBusSubsystem::Publish(this, ECombatEventType::Move, this, nullptr, TargetCoord);
+
+	// 즉시 판정 모드: 턴은 다음 프레임에 바로 넘기고, 이동 연출은 따라오기만 함
+	bMoveResolvedEarly = UPortfolioGameInstance::IsInstantResolve(this);
+	if (bMoveResolvedEarly)
+	{
+		GetWorld()->GetTimerManager().SetTimer(StopAnimTimerHandle, this, &ACharacterBase::OnStopAnimEnded, KINDA_SMALL_NUMBER, false);
+	}
 
 	// BattleManager를 통해 목표 좌표의 월드 위치를 가져옴
 	if (BattleManagerRef)
@@ -291,9 +443,10 @@ void ACharacterBase::MoveToCell(FIntPoint TargetCoord, int32 TargetIndex)
 	}
 }
 
-void ACharacterBase::OnHealthChanged_Wrapper(int32 CurrentHP, int32 MaxHP)
+void ACharacterBase::HandleHealthChanged(int32 CurrentHP, int32 MaxHP)
 {
-	if (BattleManagerRef && BattleManagerRef->GridActorRef)
+	// 풀에서 대기 중이면 보드에 HP바를 띄우지 않음
+	if (IsOnBoard() && BattleManagerRef && BattleManagerRef->GridActorRef)
 	{
 		AGridISM* Grid = Cast<AGridISM>(BattleManagerRef->GridActorRef);
 		if (Grid)
@@ -307,11 +460,11 @@ void ACharacterBase::OnHealthChanged_Wrapper(int32 CurrentHP, int32 MaxHP)
 	// 체력이 0 이하이고, 아직 사망 처리되지 않았다면 (bDead == false)
 	if (CurrentHP <= 0 && !bDead)
     {
-		UE_LOG(LogTemp, Error, TEXT(">>> Character Died! Checking Cast..."));
+		UE_LOG_BATTLE_UNIT(this, Verbose, TEXT(">>> %s Died! Checking Cast..."), *GetName());
         // ★ Cast가 성공하면(= 플레이어라면) 내부 로직 실행, 아니면 무시
         if (APlayerCharacter* Player = Cast<APlayerCharacter>(this))
         {
-			UE_LOG(LogTemp, Error, TEXT(">>> Player Died! Calling OnDeath BP Event."));
+			UE_LOG(LogBattle, Log, TEXT(">>> Player Died! Calling OnDeath BP Event."));
             bDead = true;
 			Player->Die(); // BP의 Event On Death 호출
         }
@@ -325,8 +478,8 @@ void ACharacterBase::OnHealthAttributeChanged(const FOnAttributeChangeData& Data
 	float NewHealth = Data.NewValue;
 	float MaxHealth = Attributes->GetMaxHP(); // MaxHealth는 변동 없다고 가정, 필요시 이것도 감지해야 함
 
-	// 기존에 만들어둔 델리게이트 방송 -> GridISM의 UpdateTileHPBar가 호출됨
-	OnHealthChanged.Broadcast((int32)NewHealth, (int32)MaxHealth);
+	// HandleHealthChanged -> GridISM의 UpdateTileHPBar가 호출됨
+	NotifyHealthChanged((int32)NewHealth, (int32)MaxHealth);
 
 	//if (BattleManagerRef && BattleManagerRef->GridActorRef)
 	//{
@@ -342,11 +495,11 @@ void ACharacterBase::OnHealthAttributeChanged(const FOnAttributeChangeData& Data
 	// 체력이 0 이하이고, 아직 사망 처리되지 않았다면 (bDead == false)
 	if (NewHealth <= 0 && !bDead)
 	{
-		UE_LOG(LogTemp, Error, TEXT(">>> Character Died! Checking Cast..."));
+		UE_LOG_BATTLE_UNIT(this, Verbose, TEXT(">>> %s Died! Checking Cast..."), *GetName());
 		// ★ Cast가 성공하면(= 플레이어라면) 내부 로직 실행, 아니면 무시
 		if (Cast<APlayerCharacter>(this))
 		{
-			UE_LOG(LogTemp, Error, TEXT(">>> Player Died! Calling OnDeath BP Event."));
+			UE_LOG(LogBattle, Log, TEXT(">>> Player Died! Calling OnDeath BP Event."));
 			bDead = true;
 			OnDeath(); // BP의 Event On Death 호출
 		}
@@ -380,97 +533,183 @@ void ACharacterBase::SetHighlight(bool bEnable)
  * (신규) EnemyCharacter가 호출할 수 있도록 ApplyDamage를 다시 구현합니다.
  */
 void ACharacterBase::ApplyDamage(float Damage)
+{
+	if (Attributes)
+	{
+		ApplyDamageDeferred(Damage);
+
+		// UpdateTileHPBar가 즉시 호출
+		BroadcastHealthChanged();
+	}
+}
+
+void ACharacterBase::ApplyDamageDeferred(float Damage, AActor* Instigator)
 {
 	if (Attributes)
 	{
 		// BaseAttributeSet.h에 정의된 인라인 함수 사용
 		Attributes->ApplyDamage(Damage);
+		UCombatEventBusSubsystem::Publish(this, ECombatEventType::Damage, Instigator, this, GridCoord, FMath::RoundToInt(Damage));
+	}
+}
 
+void ACharacterBase::BroadcastHealthChanged()
+{
+	if (Attributes)
+	{
 		int32 CurrentHP = FMath::RoundToInt(Attributes->GetHealth_BP());
 		int32 MaxHP = FMath::RoundToInt(Attributes->GetMaxHealth_BP());
+		NotifyHealthChanged(CurrentHP, MaxHP);
+	}
+}
 
-		// UpdateTileHPBar가 즉시 호출
-		OnHealthChanged.Broadcast(CurrentHP, MaxHP);
+void ACharacterBase::NotifyHealthChanged(int32 CurrentHP, int32 MaxHP)
+{
+	// 네이티브 처리는 가상 호출로 (동적 델리게이트/ProcessEvent 거치지 않음)
+	HandleHealthChanged(CurrentHP, MaxHP);
+
+	if (UCombatEventBusSubsystem* Bus = UCombatEventBusSubsystem::Get(this))
+	{
+		FCombatEvent Event;
+		Event.Type = ECombatEventType::HealthChanged;
+		Event.Source = this;
+		Event.Cell = GridCoord;
+		Event.Value = CurrentHP;
+		Event.SubValue = MaxHP;
+		Bus->Publish(Event);
 	}
+
+	// BP 구독자 (HP바 액터 등)
+	OnHealthChanged.Broadcast(CurrentHP, MaxHP);
+}
+
+int32 ACharacterBase::GetCurrentHP() const
+{
+	return Attributes ? FMath::RoundToInt(Attributes->GetHealth_BP()) : 0;
 }
 
-// 매 프레임 호출
-void ACharacterBase::Tick(float DeltaTime)
+// 이동 연출 도착 (UGridMotionSubsystem이 목표 위치로 옮긴 뒤 호출)
+void ACharacterBase::FinishVisualMove()
 {
-	Super::Tick(DeltaTime);
+	// A. 이동 플래그 끄기 (위치는 서브시스템에서 확정)
+	bIsVisualMoving = false;
 
-	if (bIsVisualMoving)
+	// B. 뛰는 모션(RunMontage) 강제 종료 (잔상/제자리 달리기 방지)
+	if (RunMontage && GetMesh()->GetAnimInstance())
 	{
-		// 1. 시간 누적 및 진행률(Alpha) 계산
-		VisualMoveTimeElapsed += DeltaTime;
-		float Alpha = FMath::Clamp(VisualMoveTimeElapsed / VisualMoveDuration, 0.0f, 1.0f);
+		// 0.1초 동안 부드럽게 멈춤 (즉시 뚝 끊기지 않게)
+		GetMesh()->GetAnimInstance()->Montage_Stop(0.1f, RunMontage);
+	}
 
-		// 2. 위치 보간 (Lerp)
-		FVector NewLoc = FMath::Lerp(VisualMoveStartLocation, VisualMoveDestination, Alpha);
-		NewLoc.Z = VisualMoveStartLocation.Z;
-		SetActorLocation(NewLoc);
+	// C. 대기 시간 계산
+	float WaitTime = 0.1f;
 
-		// 3. [도착 판정]
-		if (Alpha >= 1.0f)
+	// D. 정지 몽타주(CurrentStopMontage) 재생
+	if (CurrentStopMontage && GetMesh()->GetAnimInstance())
+	{
+		float Duration = PlayAnimMontage(CurrentStopMontage);
+		if (bMoveResolvedEarly)
 		{
-			// A. 위치 확정 & 이동 플래그 끄기
-			FVector FinalLoc = VisualMoveDestination;
-			FinalLoc.Z = VisualMoveStartLocation.Z;
-			SetActorLocation(VisualMoveDestination);
-			bIsVisualMoving = false;
-
-			// B. 뛰는 모션(RunMontage) 강제 종료 (잔상/제자리 달리기 방지)
-			if (RunMontage && GetMesh()->GetAnimInstance())
-			{
-				// 0.1초 동안 부드럽게 멈춤 (즉시 뚝 끊기지 않게)
-				GetMesh()->GetAnimInstance()->Montage_Stop(0.1f, RunMontage);
-			}
+			MarkMontageSkippable(CurrentStopMontage);
+		}
 
-			// C. 대기 시간 계산
-			float WaitTime = 0.1f;
+		// 몽타주가 정상 재생됐다면, 그 길이만큼 기다림
+		if (Duration > 0.0f)
+		{
+			WaitTime = Duration;
+		}
+	}
 
-			// D. 정지 몽타주(CurrentStopMontage) 재생
-			if (CurrentStopMontage && GetMesh()->GetAnimInstance())
-			{
-				float Duration = PlayAnimMontage(CurrentStopMontage);
+	// E. 계산된 시간만큼 기다렸다가 턴 종료 (즉시 판정으로 이미 넘긴 턴이면 생략)
+	if (!bMoveResolvedEarly)
+	{
+		GetWorld()->GetTimerManager().SetTimer(
+			StopAnimTimerHandle,
+			this,
+			&ACharacterBase::OnStopAnimEnded,
+			WaitTime,
+			false
+		);
+	}
+	bMoveResolvedEarly = false;
 
-				// 몽타주가 정상 재생됐다면, 그 길이만큼 기다림
-				if (Duration > 0.0f)
-				{
-					WaitTime = Duration;
-				}
-			}
+	// F. HP바 위치 갱신 (기존 로직 유지)
+	if (BattleManagerRef && BattleManagerRef->GridActorRef)
+	{
+		AGridISM* Grid = Cast<AGridISM>(BattleManagerRef->GridActorRef);
+		if (Grid && Attributes)
+		{
+			// 출발지 끄기
+			Grid->UpdateTileHPBar(CachedGridIndex, false);
+
+			// 도착지 켜기
+			int32 Cur = FMath::RoundToInt(Attributes->GetHealth_BP());
+			int32 Max = FMath::RoundToInt(Attributes->GetMaxHealth_BP());
+			Grid->UpdateTileHPBar(GridIndex, true, Cur, Max);
 
-			// E. 계산된 시간만큼 기다렸다가 턴 종료
-			GetWorld()->GetTimerManager().SetTimer(
-				StopAnimTimerHandle,
-				this,
-				&ACharacterBase::OnStopAnimEnded,
-				WaitTime,
-				false
-			);
-
-			// F. HP바 위치 갱신 (기존 로직 유지)
-			if (BattleManagerRef && BattleManagerRef->GridActorRef)
+			// 캐시 갱신
+			CachedGridIndex = GridIndex;
+		}
+	}
+}
+
+void ACharacterBase::MarkMontageSkippable(UAnimMontage* Montage)
+{
+	UAnimInstance* AnimInst = GetMesh() ? GetMesh()->GetAnimInstance() : nullptr;
+	if (!AnimInst || !Montage) return;
+
+	if (const FAnimMontageInstance* Inst = AnimInst->GetActiveInstanceForMontage(Montage))
+	{
+		SkippableMontageInstances.AddUnique(Inst->GetInstanceID());
+	}
+}
+
+void ACharacterBase::SkipMontagesToEnd()
+{
+	UAnimInstance* AnimInst = GetMesh() ? GetMesh()->GetAnimInstance() : nullptr;
+	if (!AnimInst)
+	{
+		SkippableMontageInstances.Reset();
+		return;
+	}
+
+	// 이미 끝난 인스턴스는 목록에서 제거
+	SkippableMontageInstances.RemoveAll([AnimInst](int32 InstanceID)
+	{
+		return AnimInst->GetMontageInstanceForID(InstanceID) == nullptr;
+	});
+
+	for (FAnimMontageInstance* Inst : AnimInst->MontageInstances)
+	{
+		if (!Inst || !Inst->IsActive() || !Inst->Montage) continue;
+
+		// 즉시 판정 모드에서 시작한 연출만 (모드 전환 전에 시작된 몽타주는 노티파이를 기다리는 중일 수 있음)
+		if (!SkippableMontageInstances.Contains(Inst->GetInstanceID())) continue;
+
+		const int32 CurrentSection = Inst->Montage->GetSectionIndexFromPosition(Inst->GetPosition());
+		if (CurrentSection == INDEX_NONE) continue;
+
+		// 대기 루프(자기 자신으로 연결된 섹션) 중이면 건너뛸 것이 없음
+		if (Inst->GetNextSectionID(CurrentSection) == CurrentSection) continue;
+
+		// 다음 섹션 연결을 따라가 마지막 섹션 또는 루프 섹션을 찾음 (순환 연결 대비 섹션 수만큼만)
+		int32 LastSection = CurrentSection;
+		bool bEndsInLoop = false;
+		for (int32 Step = 0; Step < Inst->Montage->CompositeSections.Num(); ++Step)
+		{
+			const int32 Next = Inst->GetNextSectionID(LastSection);
+			if (Next == INDEX_NONE) break;
+			if (Next == LastSection)
 			{
-				AGridISM* Grid = Cast<AGridISM>(BattleManagerRef->GridActorRef);
-				if (Grid && Attributes)
-				{
-					// 출발지 끄기
-					Grid->UpdateTileHPBar(CachedGridIndex, false);
-
-					// 도착지 켜기
-					int32 Cur = FMath::RoundToInt(Attributes->GetHealth_BP());
-					int32 Max = FMath::RoundToInt(Attributes->GetMaxHealth_BP());
-					Grid->UpdateTileHPBar(GridIndex, true, Cur, Max);
-
-					// 캐시 갱신
-					CachedGridIndex = GridIndex;
-				}
+				bEndsInLoop = true;
+				break;
 			}
+			LastSection = Next;
 		}
-	}
 
+		// 루프로 끝나면 루프 섹션 처음으로 (정지/대기 자세 유지), 아니면 마지막 섹션 끝으로 (다음 갱신에서 종료)
+		Inst->JumpToSectionName(Inst->Montage->GetSectionName(LastSection), !bEndsInLoop);
+	}
 }
 
 void ACharacterBase::OnStopAnimEnded()
@@ -516,6 +755,10 @@ void ACharacterBase::TickRotationWindow(float DeltaTime)
 	// Slerp로 부드럽게 돌리기
 	FQuat NewQuat = FQuat::Slerp(RotationStartQuat, RotationTargetQuat, Alpha);
 	SetActorRotation(NewQuat);
+	if (IsPlayerControlled())
+	{
+		FInputLatencyTracer::Mark(EInputLatencyStage::FirstMotion);
+	}
 }
 
 // 4. [신규] 노티파이가 호출: 회전 끝
@@ -529,19 +772,27 @@ void ACharacterBase::EndRotationWindow()
 // 이동 시작 (내부 함수)
 void ACharacterBase::StartVisualMove(const FVector& TargetLocation)
 {
-	// 시작점과 목표점 기록
-	VisualMoveStartLocation = GetActorLocation();
-	VisualMoveDestination = TargetLocation;
-
-	// 시간 초기화
-	VisualMoveTimeElapsed = 0.0f;
+	// 시작점과 목표점을 이동 서브시스템에 등록 (도착하면 FinishVisualMove 호출)
+	if (UGridMotionSubsystem* Motion = GetWorld()->GetSubsystem<UGridMotionSubsystem>())
+	{
+		Motion->StartMove(this, GetActorLocation(), TargetLocation, VisualMoveDuration);
+	}
 	bIsVisualMoving = true;
 
+	if (IsPlayerControlled())
+	{
+		FInputLatencyTracer::Mark(EInputLatencyStage::VisualStart);
+	}
+
 	OnBusyStateChanged.Broadcast(true);
 
 	// 애니메이션 재생
 	if (RunMontage)
 	{
 		PlayAnimMontage(RunMontage);
+		if (bMoveResolvedEarly)
+		{
+			MarkMontageSkippable(RunMontage);
+		}
 	}
 }
\ No newline at end of file
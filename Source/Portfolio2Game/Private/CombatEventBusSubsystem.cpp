@@ -0,0 +1,113 @@
+﻿#include "CombatEventBusSubsystem.h"
+#include "Portfolio2Game.h"
+#include "HAL/IConsoleManager.h"
+
+namespace CombatEventBusPrivate
+{
+	static TAutoConsoleVariable<bool> CVarLog(
+		TEXT("Battle.Events.Log"),
+		false,
+		TEXT("전투 이벤트 버스에 발행되는 모든 이벤트를 로그로 출력합니다."));
+
+	static const TCHAR* GetTypeName(ECombatEventType Type)
+	{
+		switch (Type)
+		{
+		case ECombatEventType::Damage:		return TEXT("Damage");
+		case ECombatEventType::Death:		return TEXT("Death");
+		case ECombatEventType::Move:		return TEXT("Move");
+		case ECombatEventType::Rotate:		return TEXT("Rotate");
+		case ECombatEventType::Reserve:		return TEXT("Reserve");
+		case ECombatEventType::Fire:		return TEXT("Fire");
+		case ECombatEventType::RoundStart:	return TEXT("RoundStart");
+		case ECombatEventType::TurnStart:	return TEXT("TurnStart");
+		case ECombatEventType::HealthChanged:	return TEXT("HealthChanged");
+		default:							return TEXT("Unknown");
+		}
+	}
+}
+
+UCombatEventBusSubsystem* UCombatEventBusSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UCombatEventBusSubsystem>() : nullptr;
+}
+
+void UCombatEventBusSubsystem::Publish(const UObject* WorldContextObject, ECombatEventType Type, AActor* Source,
+	AActor* Target, FIntPoint Cell, int32 Value, UObject* Payload)
+{
+	UCombatEventBusSubsystem* Bus = Get(WorldContextObject);
+	if (!Bus) return;
+
+	FCombatEvent Event;
+	Event.Type = Type;
+	Event.Source = Source;
+	Event.Target = Target;
+	Event.Payload = Payload;
+	Event.Cell = Cell;
+	Event.Value = Value;
+	Bus->Publish(Event);
+}
+
+void UCombatEventBusSubsystem::Publish(const FCombatEvent& InEvent)
+{
+	if (InEvent.Type == ECombatEventType::TurnStart)
+	{
+		CurrentTurn = InEvent.Value;
+	}
+
+	FCombatEvent Event = InEvent;
+	Event.Turn = CurrentTurn;
+	Event.Frame = (int32)(GFrameCounter & MAX_int32);
+
+	if (CombatEventBusPrivate::CVarLog.GetValueOnGameThread())
+	{
+		UE_LOG(LogBattle, Log, TEXT("[Event] T%d F%d %s Src=%s Dst=%s Cell=(%d,%d) Value=%d/%d %s"),
+			Event.Turn, Event.Frame, CombatEventBusPrivate::GetTypeName(Event.Type),
+			*GetNameSafe(Event.Source), *GetNameSafe(Event.Target), Event.Cell.X, Event.Cell.Y, Event.Value, Event.SubValue,
+			*GetNameSafe(Event.Payload));
+	}
+
+	// 네이티브: 즉시
+	TypeListeners[(int32)Event.Type].Broadcast(Event);
+	AnyListeners.Broadcast(Event);
+
+	// BP: 구독자가 있을 때만 모아 둠
+	if (OnCombatEventBatch.IsBound())
+	{
+		PendingBatch.Add(Event);
+	}
+}
+
+void UCombatEventBusSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 용량은 두 배열이 번갈아 재사용
+	Swap(PendingBatch, DispatchBatch);
+	OnCombatEventBatch.Broadcast(DispatchBatch);
+	DispatchBatch.Reset();
+}
+
+bool UCombatEventBusSubsystem::IsTickable() const
+{
+	return PendingBatch.Num() > 0;
+}
+
+TStatId UCombatEventBusSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatEventBusSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatEventBusSubsystem::Deinitialize()
+{
+	for (FOnCombatEventNative& Listeners : TypeListeners)
+	{
+		Listeners.Clear();
+	}
+	AnyListeners.Clear();
+	PendingBatch.Empty();
+	DispatchBatch.Empty();
+
+	Super::Deinitialize();
+}
@@ -0,0 +1,52 @@
+﻿#include "DamageBatch.h"
+#include "Portfolio2Game.h"
+#include "CharacterBase.h"
+
+void FDamageBatch::Add(ACharacterBase* Target, float Damage, AActor* Instigator)
+{
+	if (!Target || Damage <= 0.0f) return;
+
+	FEntry* Entry = Entries.FindByPredicate([Target, Instigator](const FEntry& E) { return E.Target == Target && E.Instigator == Instigator; });
+	if (!Entry)
+	{
+		Entry = &Entries.AddDefaulted_GetRef();
+		Entry->Target = Target;
+		Entry->Instigator = Instigator;
+	}
+
+	Entry->Damage += Damage;
+	Entry->Hits++;
+}
+
+void FDamageBatch::Resolve()
+{
+	// 1. 체력만 먼저 전부 반영 (이 단계에서는 델리게이트/사망 처리 없음)
+	for (const FEntry& Entry : Entries)
+	{
+		if (IsValid(Entry.Target))
+		{
+			Entry.Target->ApplyDamageDeferred(Entry.Damage, Entry.Instigator);
+			UE_LOG_BATTLE_UNIT(Entry.Target, Verbose, TEXT("[Damage] %s took %.0f (%d hit(s))"), *Entry.Target->GetName(), Entry.Damage, Entry.Hits);
+		}
+	}
+
+	// 2. 생존자 이벤트 (HP바 갱신 / 피격 모션)
+	for (const FEntry& Entry : Entries)
+	{
+		if (IsValid(Entry.Target) && Entry.Target->GetCurrentHP() > 0)
+		{
+			Entry.Target->BroadcastHealthChanged();
+		}
+	}
+
+	// 3. 사망자 이벤트 (Die -> OnEnemyKilled 등 보드 변경은 판정이 끝난 뒤에만)
+	for (const FEntry& Entry : Entries)
+	{
+		if (IsValid(Entry.Target) && Entry.Target->GetCurrentHP() <= 0)
+		{
+			Entry.Target->BroadcastHealthChanged();
+		}
+	}
+
+	Entries.Reset();
+}
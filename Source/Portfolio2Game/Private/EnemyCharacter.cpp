@@ -1,4 +1,5 @@
 ﻿#include "EnemyCharacter.h"
+#include "Portfolio2Game.h"
 #include "PlayerCharacter.h"
 #include "BattleManager.h"
 #include "PortfolioGameInstance.h"
@@ -7,6 +8,10 @@
 #include "Components/Widget.h"
 #include "Components/CapsuleComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "GridISM.h"
+#include "ThreatMapComponent.h"
+#include "GridMotionSubsystem.h"
+#include "CombatEventBusSubsystem.h"
 
 AEnemyCharacter::AEnemyCharacter()
 {
@@ -32,7 +37,42 @@ void AEnemyCharacter::BeginPlay()
 {
     Super::BeginPlay();
 
+	// 몽타주 섹션 인덱스/길이는 여기서 한 번만 조회
+	StateSections.Build(StateMontage);
+	AtkSections_A.Build(Montage_Atk_A);
+	AtkSections_B.Build(Montage_Atk_B);
+
+	// 사망 후 재사용 시 복구할 충돌 설정 기억
+	DefaultCapsuleCollision = GetCapsuleComponent()->GetCollisionEnabled();
+	if (GetMesh())
+	{
+		DefaultMeshCollision = GetMesh()->GetCollisionEnabled();
+	}
+
 	// 2. 난이도에 따른 체력 보정 적용
+	ApplyDifficultyScaling();
+	GetAttributeBaseValues(SpawnAttributeBases);
+
+	//순서 숨김
+	HideActionOrder();
+
+    PlayerRef = Cast<APlayerCharacter>(
+        UGameplayStatics::GetActorOfClass(GetWorld(), APlayerCharacter::StaticClass()));
+
+	// 풀 예열용 스폰이면 등장 연출 없이 바로 대기 상태로
+	if (bInPool)
+	{
+		DeactivateForPool();
+		return;
+	}
+
+	PlaySpawnAnimation();
+
+	RotateToDirection(EGridDirection::Left, false);
+}
+
+void AEnemyCharacter::ApplyDifficultyScaling()
+{
 	if (UPortfolioGameInstance* GI = Cast<UPortfolioGameInstance>(GetGameInstance()))
 	{
 		int32 Difficulty = GI->DifficultyLevel;
@@ -51,41 +91,30 @@ void AEnemyCharacter::BeginPlay()
 			AbilitySystem->SetNumericAttributeBase(UBaseAttributeSet::GetMaxHPAttribute(), NewMaxHP);
 			AbilitySystem->SetNumericAttributeBase(UBaseAttributeSet::GetHPAttribute(), NewMaxHP); // 현재 체력도 회복
 
-			OnHealthChanged.Broadcast((int32)NewMaxHP, (int32)NewMaxHP);
+			NotifyHealthChanged((int32)NewMaxHP, (int32)NewMaxHP);
 
-			UE_LOG(LogTemp, Warning, TEXT("[%s] HP Scaled by Difficulty %d: %.0f -> %.0f (+%.0f)"),
+			UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("[%s] HP Scaled by Difficulty %d: %.0f -> %.0f (+%.0f)"),
 				*GetName(), Difficulty, BaseHP, NewMaxHP, BonusHP);
 		}
 	}
+}
 
-	//순서 숨김
-	HideActionOrder();
-
-    PlayerRef = Cast<APlayerCharacter>(
-        UGameplayStatics::GetActorOfClass(GetWorld(), APlayerCharacter::StaticClass()));
-
-	// 체력이 변하면 HandleHealthChanged 함수가 자동 실행
-	if (HasAuthority())
-	{
-		OnHealthChanged.AddDynamic(this, &AEnemyCharacter::HandleHealthChanged);
-	}
-
+void AEnemyCharacter::PlaySpawnAnimation()
+{
 	if (GetMesh() && GetMesh()->GetAnimInstance())
 	{
 		// A. 별도 스폰 몽타주가 있다면 (Super 몹 등)
 		if (SpawnMontage)
 		{
-			PlayAnimMontage(SpawnMontage);
+			RequestFullRateAnim(PlayAnimMontage(SpawnMontage));
 		}
 		// B. 없다면 State 몽타주의 Default 섹션 재생
 		else if (StateMontage)
 		{
 			GetMesh()->GetAnimInstance()->Montage_Play(StateMontage);
-			GetMesh()->GetAnimInstance()->Montage_JumpToSection(FName("Default"), StateMontage);
+			GetMesh()->GetAnimInstance()->Montage_JumpToSection(GetMontageSectionName(EMontageSection::Default), StateMontage);
 		}
 	}
-
-	RotateToDirection(EGridDirection::Left, false);
 }
 
 UAnimMontage* AEnemyCharacter::GetAttackMontageForSkill(USkillBase* SkillDef)
@@ -118,7 +147,10 @@ void AEnemyCharacter::PlayChargeMontageIfReady()
 				GetMesh()->GetAnimInstance()->Montage_Play(Montage);
 			}
 			// ★ "Ready" 섹션으로 이동 -> 이후 "Ready_Stay"에서 루프 돎
-			GetMesh()->GetAnimInstance()->Montage_JumpToSection(FName("Ready"), Montage);
+			if (GetAttackSections(Montage).HasSection(EMontageSection::Ready))
+			{
+				GetMesh()->GetAnimInstance()->Montage_JumpToSection(GetMontageSectionName(EMontageSection::Ready), Montage);
+			}
 		}
 	}
 }
@@ -180,6 +212,7 @@ void AEnemyCharacter::DecideNextAction()
 
 	PendingAction = BestAction;
 	PlayChargeMontageIfReady();
+	OnGridStateChanged();
 }
 
 // 2단계: 행동하기 (저장된 값으로 실행)
@@ -191,7 +224,7 @@ void AEnemyCharacter::ExecutePlannedAction()
 		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("%s Executing Plan: %d"), *GetName(), (int32)PendingAction);
+	UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("%s Executing Plan: %d"), *GetName(), (int32)PendingAction);
 
 	// 저장해둔 행동 실행 (기존 PerformAction 호출)
 	PerformAction(PendingAction);
@@ -400,6 +433,7 @@ void AEnemyCharacter::Action_FireReserved()
 {
 	if (ReservedSkill) ExecuteSkill(ReservedSkill);
 	ReservedSkill = nullptr;
+	OnGridStateChanged();
 	bJustAttacked = true;
 	EndAction();
 }
@@ -407,8 +441,10 @@ void AEnemyCharacter::Action_FireReserved()
 void AEnemyCharacter::Action_ReserveSkill(USkillBase* Skill)
 {
 	ReservedSkill = Skill;
+	OnGridStateChanged();
+	UCombatEventBusSubsystem::Publish(this, ECombatEventType::Reserve, this, nullptr, GridCoord, 0, Skill);
 
-	UE_LOG(LogTemp, Warning, TEXT("Skill Reserved: %s"), *Skill->SkillName.ToString());
+	UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("%s Skill Reserved: %s"), *GetName(), *GetNameSafe(Skill));
 	bJustAttacked = false;
 	EndAction();
 }
@@ -475,7 +511,7 @@ bool AEnemyCharacter::ExecuteSkill(USkillBase* SkillToUse)
 		Payload.Target = this;
 
 		// 4. 발동 신호 전송
-		FGameplayTag TriggerTag = FGameplayTag::RequestGameplayTag(TEXT("Ability.Skill.Attack"));
+		static const FGameplayTag TriggerTag = FGameplayTag::RequestGameplayTag(TEXT("Ability.Skill.Attack"));
 
 		AbilitySystem->TriggerAbilityFromGameplayEvent(
 			Spec->Handle,
@@ -485,7 +521,7 @@ bool AEnemyCharacter::ExecuteSkill(USkillBase* SkillToUse)
 			*AbilitySystem
 		);
 
-		UE_LOG(LogTemp, Warning, TEXT("%s Used Skill: %s"), *GetName(), *SkillToUse->SkillName.ToString());
+		UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("%s Used Skill: %s"), *GetName(), *SkillToUse->SkillName.ToString());
 		return true;
 	}
 
@@ -501,17 +537,17 @@ bool AEnemyCharacter::GetBestMovementToAttack(USkillBase* Skill, EGridDirection&
 	// [디버그 1] 필수 데이터 체크
 	if (!Skill)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[AI Fail] Skill is NULL! BP_EnemyCharacter에서 Skill_A를 할당했는지 확인하세요."));
+		UE_LOG(LogBattle, Warning, TEXT("[AI Fail] Skill is NULL! BP_EnemyCharacter에서 Skill_A를 할당했는지 확인하세요."));
 		return false;
 	}
 	if (!PlayerRef)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[AI Fail] PlayerRef is NULL!"));
+		UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("[AI Fail] %s PlayerRef is NULL!"), *GetName());
 		return false;
 	}
 	if (!BattleManagerRef || !BattleManagerRef->GridInterface)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[AI Fail] GridInterface is NULL!"));
+		UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("[AI Fail] %s GridInterface is NULL!"), *GetName());
 		return false;
 	}
 
@@ -519,33 +555,32 @@ bool AEnemyCharacter::GetBestMovementToAttack(USkillBase* Skill, EGridDirection&
 	FIntPoint PlayerPos = PlayerRef->GridCoord;
 
 	// 1. 맵 크기 가져오기 (경계 검사용)
-	if (!BattleManagerRef->GridInterface) return false;
-	int32 MapW = IGridDataInterface::Execute_GetGridWidth(BattleManagerRef->GridActorRef);
-	int32 MapH = IGridDataInterface::Execute_GetGridHeight(BattleManagerRef->GridActorRef);
+	const FGridGeometry& Grid = BattleManagerRef->GetGridGeometry();
+	if (!Grid.IsValid()) return false;
+	int32 MapW = Grid.Width;
+	int32 MapH = Grid.Height;
 
 	// 2. "명당(Sweet Spots)" 리스트 확보
 	// 명당이란? -> 내가 거기 서 있으면 플레이어를 때릴 수 있는 모든 좌표
 	// (적은 회전이 자유로우므로, 4방향 회전을 모두 가정한 공격 위치를 다 찾습니다)
-	TArray<FIntPoint> SweetSpots;
+	// 턴 중 힙 할당을 피하도록 인라인 버퍼 사용 (패턴 8칸 x 4방향까지)
+	TArray<FIntPoint, TInlineAllocator<32>> SweetSpots;
+	SweetSpots.Reserve(Skill->AttackPattern.Num() * 4);
 
 	for (const FIntPoint& Point : Skill->AttackPattern)
 	{
-		// Y축 반전(-Point.Y) 적용 (좌표계 통일)
-		int32 PX = Point.X;
-		int32 PY = -Point.Y;
-
-		// 플레이어 위치에서 역산 -> "내가 서야 할 위치"
-		SweetSpots.Add(PlayerPos - FIntPoint(PX, PY));   // 내가 Right 볼 때
-		SweetSpots.Add(PlayerPos - FIntPoint(-PX, -PY)); // 내가 Left 볼 때
-		SweetSpots.Add(PlayerPos - FIntPoint(-PY, PX));  // 내가 Down 볼 때
-		SweetSpots.Add(PlayerPos - FIntPoint(PY, -PX));  // 내가 Up 볼 때
+		// 플레이어 위치에서 역산 -> "내가 서야 할 위치" (Right, Left, Down, Up 순)
+		SweetSpots.Add(PlayerPos - RotatePatternOffset(Point, EGridDirection::Right));
+		SweetSpots.Add(PlayerPos - RotatePatternOffset(Point, EGridDirection::Left));
+		SweetSpots.Add(PlayerPos - RotatePatternOffset(Point, EGridDirection::Down));
+		SweetSpots.Add(PlayerPos - RotatePatternOffset(Point, EGridDirection::Up));
 	}
 
 
 	// [디버그 2] 명당 계산 결과
 	if (SweetSpots.Num() == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[AI Fail] SweetSpots is Empty! 스킬 데이터(%s)의 AttackPattern에 좌표를 추가하세요."), *Skill->SkillName.ToString());
+		UE_LOG(LogBattle, Warning, TEXT("[AI Fail] SweetSpots is Empty! 스킬 데이터(%s)의 AttackPattern에 좌표를 추가하세요."), *Skill->SkillName.ToString());
 		return false;
 	}
 
@@ -604,7 +639,7 @@ bool AEnemyCharacter::GetBestMovementToAttack(USkillBase* Skill, EGridDirection&
 	// [디버그 3] 최종 결과
 	if (!bFoundValidMove)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[AI Fail] 갈 수 있는 칸이 없거나 더 가까워질 수 없음 (Current: %d,%d)"), MyPos.X, MyPos.Y);
+		UE_LOG_BATTLE_UNIT(this, VeryVerbose, TEXT("[AI Fail] %s 갈 수 있는 칸이 없거나 더 가까워질 수 없음 (Current: %d,%d)"), *GetName(), MyPos.X, MyPos.Y);
 	}
 
 	return bFoundValidMove;
@@ -648,7 +683,9 @@ bool AEnemyCharacter::IsPlayerInSkillRange(USkillBase* Skill)
 // 피격 및 사망
 void AEnemyCharacter::HandleHealthChanged(int32 NewHP, int32 NewMaxHP)
 {
-	if (bDead) return;
+	Super::HandleHealthChanged(NewHP, NewMaxHP);
+
+	if (bDead || !HasAuthority()) return;
 
 	if (NewHP <= 0)
 	{
@@ -664,8 +701,9 @@ void AEnemyCharacter::HandleHealthChanged(int32 NewHP, int32 NewMaxHP)
 			{
 				GetMesh()->GetAnimInstance()->Montage_Play(StateMontage);
 			}
-			// Hit 섹션으로 점프
-			GetMesh()->GetAnimInstance()->Montage_JumpToSection(FName("Hit"), StateMontage);
+			// Hit 섹션으로 점프 (피격 중에는 풀 레이트)
+			GetMesh()->GetAnimInstance()->Montage_JumpToSection(GetMontageSectionName(EMontageSection::Hit), StateMontage);
+			RequestFullRateAnim(StateSections.GetLength(EMontageSection::Hit));
 		}
 	}
 }
@@ -676,7 +714,8 @@ void AEnemyCharacter::Die()
 	if (bDead) return;
 	bDead = true;
 
-	UE_LOG(LogTemp, Warning, TEXT("%s Died!"), *GetName());
+	UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("%s Died!"), *GetName());
+	UCombatEventBusSubsystem::Publish(this, ECombatEventType::Death, this, nullptr, GridCoord);
 
 	// 2. 충돌 끄기
 	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
@@ -692,6 +731,7 @@ void AEnemyCharacter::Die()
 	}
 
 	// 4. 배틀 매니저 알림
+	OnGridStateChanged();
 	if (BattleManagerRef)
 	{
 		BattleManagerRef->OnEnemyKilled(this);
@@ -706,15 +746,15 @@ void AEnemyCharacter::Die()
 
 		// 몽타주 재생 및 섹션 점프
 		AnimInst->Montage_Play(StateMontage);
-		AnimInst->Montage_JumpToSection(FName("Death"), StateMontage);
+		AnimInst->Montage_JumpToSection(GetMontageSectionName(EMontageSection::Death), StateMontage);
 
 		// ★ [핵심] 'Death'가 끝나면 다음 섹션(Death_Stay)으로 가지 말고 멈추라고 명령
 		// (다음 섹션을 NAME_None으로 설정하면 링크가 끊깁니다)
-		AnimInst->Montage_SetNextSection(FName("Death"), FName("None"), StateMontage);
+		AnimInst->Montage_SetNextSection(GetMontageSectionName(EMontageSection::Death), NAME_None, StateMontage);
 
-		// ★ [핵심] 전체 길이가 아니라 'Death' 섹션 하나의 길이만 가져오기
-		int32 SectionIndex = StateMontage->GetSectionIndex(FName("Death"));
-		SectionLength = StateMontage->GetSectionLength(SectionIndex);
+		// ★ [핵심] 전체 길이가 아니라 'Death' 섹션 하나의 길이만 가져오기 (BeginPlay에서 캐시)
+		SectionLength = StateSections.GetLength(EMontageSection::Death);
+		RequestFullRateAnim(SectionLength);
 	}
 
 	// 6. 파괴 타이머 (Death 섹션 길이의 95% 지점)
@@ -737,7 +777,185 @@ void AEnemyCharacter::FinishDying()
 	if (!IsValid(this)) return;
 
 	SetActorHiddenInGame(true);
-	Destroy();
+
+	// 파괴하지 않고 풀로 반납 (다음 라운드에서 재사용)
+	if (BattleManagerRef)
+	{
+		BattleManagerRef->ReleaseEnemy(this);
+	}
+	else
+	{
+		Destroy();
+	}
+}
+
+// ───────── 풀링 ─────────
+
+void AEnemyCharacter::DeactivateForPool()
+{
+	bInPool = true;
+	bDead = true; // GetCharacterAt 등 보드 검색에서 제외
+	bCanAct = false;
+
+	GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
+
+	ResetAbilitySystemForPool();
+
+	if (GetMesh())
+	{
+		if (UAnimInstance* AnimInst = GetMesh()->GetAnimInstance())
+		{
+			AnimInst->StopAllMontages(0.0f);
+		}
+		GetMesh()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		GetMesh()->SetComponentTickEnabled(false);
+	}
+	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	HideActionOrder();
+	SetHighlight(false);
+	OnGridStateChanged();
+
+	SetActorHiddenInGame(true);
+	SetActorTickEnabled(false);
+
+	// 이동 중에 반납되면 도착 처리 없이 연출만 끊음
+	if (UGridMotionSubsystem* Motion = GetWorld()->GetSubsystem<UGridMotionSubsystem>())
+	{
+		Motion->CancelMove(this);
+	}
+	bIsVisualMoving = false;
+}
+
+void AEnemyCharacter::ResetAbilitySystemForPool()
+{
+	if (!AbilitySystem) return;
+
+	AbilitySystem->CancelAllAbilities();
+
+	// 1. 활성 GE 전부 제거 (빈 쿼리 = 전체). 풀 안에서 주기 효과가 계속 돌지 않도록 반납 시점에 정리
+	AbilitySystem->RemoveActiveEffects(FGameplayEffectQuery());
+
+	// 2. 루즈 태그 제거 (GE가 준 태그는 위에서 함께 빠졌으므로 남은 것은 루즈 태그)
+	FGameplayTagContainer OwnedTags;
+	AbilitySystem->GetOwnedGameplayTags(OwnedTags);
+	for (const FGameplayTag& Tag : OwnedTags)
+	{
+		AbilitySystem->SetLooseGameplayTagCount(Tag, 0);
+	}
+
+	// 3. 속성을 아키타입(BP 기본값)으로 되돌리고 BeginPlay와 같은 순서로 초기 스탯 GE(EffectList) -> 난이도 보정
+	// bDead가 true인 상태라 HandleHealthChanged의 피격/사망 처리는 일어나지 않음
+	if (Attributes)
+	{
+		if (const UAttributeSet* Defaults = Cast<UAttributeSet>(Attributes->GetArchetype()))
+		{
+			TArray<FGameplayAttribute> AllAttributes;
+			UAttributeSet::GetAttributesFromSetClass(Attributes->GetClass(), AllAttributes);
+			for (const FGameplayAttribute& Attribute : AllAttributes)
+			{
+				AbilitySystem->SetNumericAttributeBase(Attribute, Attribute.GetNumericValue(Defaults));
+			}
+		}
+		InitAttributes();
+		ApplyDifficultyScaling();
+
+#if !UE_BUILD_SHIPPING
+		// 재사용된 적이 새로 스폰된 적과 같은 스탯인지 확인
+		TArray<float> Current;
+		GetAttributeBaseValues(Current);
+		if (Current.Num() == SpawnAttributeBases.Num())
+		{
+			for (int32 i = 0; i < Current.Num(); ++i)
+			{
+				ensureMsgf(FMath::IsNearlyEqual(Current[i], SpawnAttributeBases[i]),
+					TEXT("%s: pooled attribute %d reset to %.1f (spawned with %.1f)"), *GetName(), i, Current[i], SpawnAttributeBases[i]);
+			}
+		}
+#endif
+	}
+}
+
+void AEnemyCharacter::GetAttributeBaseValues(TArray<float>& OutValues) const
+{
+	OutValues.Reset();
+	if (!AbilitySystem || !Attributes) return;
+
+	TArray<FGameplayAttribute> AllAttributes;
+	UAttributeSet::GetAttributesFromSetClass(Attributes->GetClass(), AllAttributes);
+	for (const FGameplayAttribute& Attribute : AllAttributes)
+	{
+		OutValues.Add(AbilitySystem->GetNumericAttributeBase(Attribute));
+	}
+}
+
+void AEnemyCharacter::ActivateFromPool(FIntPoint Coord, int32 Index)
+{
+	// 1. GAS 체력 복구 (속성/GE/태그는 DeactivateForPool에서 이미 기본값으로 초기화됨)
+	// bDead가 아직 true이므로 HandleHealthChanged의 피격 모션은 재생되지 않음
+	if (AbilitySystem && Attributes)
+	{
+		const float MaxHP = Attributes->GetMaxHP();
+		AbilitySystem->SetNumericAttributeBase(UBaseAttributeSet::GetHPAttribute(), MaxHP);
+		Attributes->SetHealth_Internal(MaxHP);
+	}
+
+	// 2. 전투 상태 초기화
+	bDead = false;
+	bCanAct = false;
+	bJustAttacked = false;
+	ReservedSkill = nullptr;
+	PendingAction = EAIActionType::Wait;
+	CurrentStopMontage = nullptr;
+	bIsVisualMoving = false;
+	bIsRotating = false;
+	bIsRotationWindowActive = false;
+
+	// 3. 위치 (논리 좌표 + 월드 위치)
+	GridCoord = Coord;
+	GridIndex = Index;
+	CachedGridIndex = Index;
+
+	if (BattleManagerRef)
+	{
+		FVector Loc = BattleManagerRef->GetWorldLocation(Coord);
+		Loc.Z += SpawnZOffset;
+		SetActorLocation(Loc, false, nullptr, ETeleportType::ResetPhysics);
+	}
+	RotateToDirection(EGridDirection::Left, false);
+
+	// 여기서부터 보드 위 유닛으로 취급 (위 체력 복구 중에는 HP바 갱신 생략)
+	bInPool = false;
+
+	// 4. 충돌/메시 틱/표시 복구
+	GetCapsuleComponent()->SetCollisionEnabled(DefaultCapsuleCollision);
+	if (GetMesh())
+	{
+		GetMesh()->SetCollisionEnabled(DefaultMeshCollision);
+		GetMesh()->SetComponentTickEnabled(true);
+	}
+	// 액터 Tick은 켜지 않음 (이동 연출은 UGridMotionSubsystem 담당)
+	SetActorHiddenInGame(false);
+
+	HideActionOrder();
+	SetHighlight(false);
+
+	// 5. HP바 켜기
+	if (BattleManagerRef)
+	{
+		if (AGridISM* Grid = Cast<AGridISM>(BattleManagerRef->GridActorRef))
+		{
+			if (Attributes)
+			{
+				const int32 Cur = FMath::RoundToInt(Attributes->GetHealth_BP());
+				const int32 Max = FMath::RoundToInt(Attributes->GetMaxHealth_BP());
+				Grid->UpdateTileHPBar(GridIndex, true, Cur, Max);
+			}
+		}
+	}
+
+	// 6. 등장 연출
+	PlaySpawnAnimation();
 }
 
 // 맵이 바뀌거나 파괴될 때 호출됨
@@ -805,6 +1023,14 @@ void AEnemyCharacter::EndAction()
 	Super::EndAction(); // 부모(CharacterBase)의 턴 종료 로직 실행
 }
 
+void AEnemyCharacter::OnGridStateChanged()
+{
+	if (BattleManagerRef && BattleManagerRef->ThreatMap)
+	{
+		BattleManagerRef->ThreatMap->UpdateEnemy(this);
+	}
+}
+
 void AEnemyCharacter::SetHighlight(bool bEnable)
 {
 	// 1. 부모 함수 호출 (외곽선 처리)
@@ -9,11 +9,13 @@ AEnemyOrderManager::AEnemyOrderManager()
 
 void AEnemyOrderManager::UpdateActionQueue(const TArray<AEnemyCharacter*>& Enemies)
 {
-	TArray<FEnemyActionIconInfo> QueueData;
+	// 이전 큐를 칸 단위로 덮어씀: 같은 스킬이 그대로 있으면 이름 문자열을 다시 만들지 않음
+	int32 Count = 0;
 
+	// BattleManager의 생존 적 목록을 그대로 받음 (사망 필터링 불필요)
 	for (AEnemyCharacter* Enemy : Enemies)
 	{
-		if (!Enemy || Enemy->bDead) continue;
+		if (!Enemy) continue;
 
 		// 공격(발사)하는 턴에만 큐 UI에 띄움
 		if (Enemy->PendingAction == EAIActionType::FireReserved)
@@ -21,14 +23,25 @@ void AEnemyOrderManager::UpdateActionQueue(const TArray<AEnemyCharacter*>& Enemi
 			USkillBase* Skill = Enemy->ReservedSkill;
 			if (Skill)
 			{
-				FEnemyActionIconInfo Info;
-				Info.Icon = Skill->SkillIcon;
-				Info.ActionName = Skill->SkillName.ToString();
-				Info.SkillRef = Skill;
-				QueueData.Add(Info);
+				if (!QueueData.IsValidIndex(Count))
+				{
+					QueueData.AddDefaulted();
+				}
+
+				FEnemyActionIconInfo& Info = QueueData[Count++];
+				if (Info.SkillRef != Skill)
+				{
+					Info.Icon = Skill->SkillIcon;
+					Info.ActionName = Skill->SkillName.ToString();
+					Info.SkillRef = Skill;
+				}
 			}
 		}
 	}
+
+	QueueData.SetNum(Count, false);
+
+	// 내용이 같아도 매번 방송 (위젯이 호출 자체를 갱신 시점으로 쓰므로 기존 계약 유지)
 	OnUpdateActionQueue.Broadcast(QueueData);
 }
 
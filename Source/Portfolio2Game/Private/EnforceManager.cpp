@@ -1,10 +1,12 @@
 ﻿#include "EnforceManager.h"
+#include "Portfolio2Game.h"
 #include "PlayerCharacter.h"
 #include "PortfolioGameInstance.h"
 #include "Kismet/GameplayStatics.h"
 #include "Blueprint/UserWidget.h"
+#include "BattleUILayerSubsystem.h"
+#include "BattleMemoryReport.h"
 #include "Camera/CameraActor.h"
-#include <Misc/OutputDeviceNull.h>
 
 AEnforceManager::AEnforceManager() {}
 
@@ -12,6 +14,12 @@ void AEnforceManager::BeginPlay()
 {
 	Super::BeginPlay();
 
+	if (bOverlayMode)
+	{
+		BeginOverlay();
+		return;
+	}
+
 	// 1. 플레이어 스폰 & 데이터 로드
 	SpawnPlayerAndInit();
 
@@ -27,34 +35,21 @@ void AEnforceManager::BeginPlay()
 	}
 
 	// 2. UI (HUD) 생성
-	if (EnforceHUDClass)
-	{
-		HUDRef = CreateWidget<UUserWidget>(GetWorld(), EnforceHUDClass);
-		if (HUDRef)
-		{
-			HUDRef->AddToViewport();
-			UE_LOG(LogTemp, Error, TEXT("EnforceManager: Enforce UI MADE!"));
-		}
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error, TEXT("EnforceManager: HUD Class is None!"));
-	}
+	CreateHUD();
 
 	// 3. 레벨 전환 연출 처리
 	UPortfolioGameInstance* GI = Cast<UPortfolioGameInstance>(GetGameInstance());
+	UBattleUILayerSubsystem* UILayer = UBattleUILayerSubsystem::Get(this);
 	if (GI && GI->bIsLevelTransitioning)
 	{
 		GI->bIsLevelTransitioning = false; // 플래그 해제
 
-		if (TransitionWidgetClass)
+		if (TransitionWidgetClass && UILayer)
 		{
-			// 화면을 덮은 상태로 위젯 생성
-			CurrentTransitionWidget = CreateWidget<UUserWidget>(GetWorld(), TransitionWidgetClass);
-			if (CurrentTransitionWidget)
+			// 이전 레벨에서 덮은 공용 전환 위젯을 그대로 이어받음 (없으면 덮인 상태로 생성)
+			UILayer->EnsureCovered(TransitionWidgetClass);
+			if (UILayer->IsCovered())
 			{
-				CurrentTransitionWidget->AddToViewport(9999); // 최상단
-
 				// 0.2초 뒤에 걷히기 시작 (로딩 튀는 것 방지)
 				FTimerHandle Handle;
 				GetWorld()->GetTimerManager().SetTimer(Handle, this, &AEnforceManager::ExecuteUncover, 0.2f, false);
@@ -62,10 +57,10 @@ void AEnforceManager::BeginPlay()
 		}
 	}
 
-	if (TopBarWidgetClass)
+	// 상단 바는 공용 UI 레이어에서 재사용
+	if (TopBarWidgetClass && UILayer)
 	{
-		UUserWidget* TopBar = CreateWidget<UUserWidget>(GetWorld(), TopBarWidgetClass);
-		if (TopBar) TopBar->AddToViewport(9000);
+		UILayer->ShowLayer(EBattleUILayer::TopBar, TopBarWidgetClass);
 	}
 
 	//delayedInputSetup실행
@@ -75,6 +70,41 @@ void AEnforceManager::BeginPlay()
 }
 
 
+void AEnforceManager::BeginOverlay()
+{
+	// 전투에서 쓰던 플레이어를 그대로 사용 (데이터 저장/복원 없음, OwnedSkills 직접 수정)
+	PlayerRef = Cast<APlayerCharacter>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
+	if (PlayerRef)
+	{
+		PlayerRef->bCanAct = false;
+	}
+
+	CreateHUD();
+
+	FTimerHandle InputSetupHandle;
+	GetWorld()->GetTimerManager().SetTimer(InputSetupHandle, this, &AEnforceManager::DelayedInputSetup, 0.1f, false);
+
+	UE_LOG(LogBattle, Verbose, TEXT("EnforceManager: Overlay Mode Started (Player: %s)"), *GetNameSafe(PlayerRef));
+}
+
+void AEnforceManager::CreateHUD()
+{
+	BATTLE_LLM_SCOPE(UI);
+	if (EnforceHUDClass)
+	{
+		HUDRef = CreateWidget<UUserWidget>(GetWorld(), EnforceHUDClass);
+		if (HUDRef)
+		{
+			HUDRef->AddToViewport();
+			UE_LOG(LogBattle, Verbose, TEXT("EnforceManager: Enforce UI created"));
+		}
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("EnforceManager: HUD Class is None!"));
+	}
+}
+
 void AEnforceManager::DelayedInputSetup()
 {
 	APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
@@ -106,12 +136,9 @@ void AEnforceManager::DelayedInputSetup()
 
 void AEnforceManager::ExecuteUncover()
 {
-	if (CurrentTransitionWidget)
+	if (UBattleUILayerSubsystem* UILayer = UBattleUILayerSubsystem::Get(this))
 	{
-		FOutputDeviceNull Ar;
-		CurrentTransitionWidget->CallFunctionByNameWithArguments(TEXT("PlayUncover"), Ar, nullptr, true);
-
-		CurrentTransitionWidget = nullptr;
+		UILayer->PlayUncover(2.0f);
 	}
 }
 
@@ -250,6 +277,7 @@ void AEnforceManager::AcquireNewSkill(USkillBase* NewSkill)
 	NewData.InitializeFromBase();
 
 	int32 NewIndex = Player->OwnedSkills.Add(NewData);
+	Player->SyncHUDSkillState(); // HUD 쿨타임 슬롯 수 갱신
 
 	UE_LOG(LogTemp, Warning, TEXT("New Skill Acquired!"));
 
@@ -274,16 +302,17 @@ void AEnforceManager::CompleteStage()
 		GI->bIsLevelTransitioning = true; // 이동 연출 플래그
 	}
 
+	// 덮는 동안 다음 맵 패키지를 미리 읽어 둠
+	if (GI)
+	{
+		GI->PreloadStageMap(GI->PeekNextStageName());
+	}
+
 	// 2. 화면 덮기 (모래바람)
-	if (TransitionWidgetClass)
+	UBattleUILayerSubsystem* UILayer = UBattleUILayerSubsystem::Get(this);
+	if (TransitionWidgetClass && UILayer)
 	{
-		UUserWidget* Widget = CreateWidget<UUserWidget>(GetWorld(), TransitionWidgetClass);
-		if (Widget)
-		{
-			Widget->AddToViewport(9999);
-			FOutputDeviceNull Ar;
-			Widget->CallFunctionByNameWithArguments(TEXT("PlayCover"), Ar, nullptr, true);
-		}
+		UILayer->PlayCover(TransitionWidgetClass);
 	}
 
 	// 3. 이동
@@ -1,7 +1,10 @@
 ﻿#include "GA_Move.h"
+#include "Portfolio2Game.h"
 #include "PlayerCharacter.h"    // APlayerCharacter의 EndAction(), bCanAct를 사용
 #include "BattleManager.h"      // BattleManager의 좌표 계산 함수 사용
-#include "GridDataInterface.h"  // BattleManager의 GridActorRef에서 그리드 크기를 가져오기 위함
+#include "GridGeometry.h"       // BattleManager에 캐시된 그리드 크기/인덱스 변환 사용
+#include "InputLatencyTracer.h"
+#include "BattleGCSubsystem.h"
 
 UGA_Move::UGA_Move()
 {
@@ -25,7 +28,7 @@ void UGA_Move::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
 	// 디버그 로그
 	if (Character)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GA_Move Try Activate: %s, bCanAct: %d"), *Character->GetName(), Character->bCanAct);
+		UE_LOG_BATTLE_UNIT(Character, VeryVerbose, TEXT("GA_Move Try Activate: %s, bCanAct: %d"), *Character->GetName(), Character->bCanAct);
 	}
 
 	if (!Character || !Character->bCanAct)
@@ -36,10 +39,14 @@ void UGA_Move::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
 		return;
 	}
 
+	if (Character->IsPlayerControlled())
+	{
+		FInputLatencyTracer::Mark(EInputLatencyStage::Activate);
+	}
+
 	ABattleManager* BattleManagerRef = Character->BattleManagerRef;
-	TScriptInterface<IGridDataInterface> GridInterface = BattleManagerRef ? BattleManagerRef->GridInterface : nullptr;
 
-	if (!BattleManagerRef || !GridInterface)
+	if (!BattleManagerRef || !BattleManagerRef->GetGridGeometry().IsValid())
 	{
 		Character->EndAction(); // 안전 장치
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
@@ -65,8 +72,9 @@ void UGA_Move::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
 	// 3. 목표 인덱스 및 경계 검사
 	const int32 CurrentIndex = Character->GridIndex;
 	int32 TargetIndex = CurrentIndex;
-	const int32 GridHeight = IGridDataInterface::Execute_GetGridHeight(GridInterface.GetObject());
-	const int32 GridWidth = IGridDataInterface::Execute_GetGridWidth(GridInterface.GetObject());
+	const FGridGeometry& Grid = BattleManagerRef->GetGridGeometry();
+	const int32 GridHeight = Grid.Height;
+	const int32 GridWidth = Grid.Width;
 
 	if (GridHeight <= 0 || GridWidth <= 0)
 	{
@@ -93,7 +101,7 @@ void UGA_Move::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
 
 	if (!bIsValidMove)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GA_Move: 이동 불가 (맵 경계)"));
+		UE_LOG_BATTLE_UNIT(Character, Verbose, TEXT("GA_Move: %s 이동 불가 (맵 경계)"), *Character->GetName());
 
 		if (APlayerCharacter* Player = Cast<APlayerCharacter>(Character))
 		{
@@ -110,11 +118,11 @@ void UGA_Move::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
 	}
 
 	// 5. 점유 검사
-	FIntPoint TargetCoord = IGridDataInterface::Execute_GetGridCoordFromIndex(GridInterface.GetObject(), TargetIndex);
+	FIntPoint TargetCoord = Grid.IndexToCoord(TargetIndex);
 
 	if (BattleManagerRef->GetCharacterAt(TargetCoord) != nullptr)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GA_Move: 이동 불가 (장애물)"));
+		UE_LOG_BATTLE_UNIT(Character, Verbose, TEXT("GA_Move: %s 이동 불가 (장애물)"), *Character->GetName());
 
 		if (APlayerCharacter* Player = Cast<APlayerCharacter>(Character))
 		{
@@ -130,10 +138,14 @@ void UGA_Move::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
 	}
 
 	// 6. 이동 실행 (성공)
-
+	// 플레이어는 검증을 통과한 여기서부터 행동 재생 구간 (적은 StartAction에서 이미 시작)
+	if (Character->IsPlayerControlled())
+	{
+		UBattleGCSubsystem::BeginActionPlayback(Character);
+	}
 
 	Character->MoveToCell(TargetCoord, TargetIndex);
 
-	// GAS 어빌리티 자체는 여기서 종료해도 됨 (캐릭터의 이동 상태는 Tick에서 관리하므로)
+	// GAS 어빌리티 자체는 여기서 종료해도 됨 (이동 연출은 UGridMotionSubsystem이 진행하므로)
 	EndAbility(Handle, ActorInfo, ActivationInfo, true, false);
 }
\ No newline at end of file
@@ -4,6 +4,13 @@
 #include "BattleManager.h"
 #include "PlayerCharacter.h"
 #include "EnemyCharacter.h"
+#include "BattlePhaseMonitor.h"
+#include "InputLatencyTracer.h"
+#include "CombatEventBusSubsystem.h"
+#include "PortfolioGameInstance.h"
+#include "MontageSectionCache.h"
+#include "DamageBatch.h"
+#include "BattleMemoryReport.h"
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraComponent.h"
@@ -47,6 +54,14 @@ void UGA_SkillAttack::ActivateAbility(const FGameplayAbilitySpecHandle Handle, c
 	}
 
 	CachedSkillInfo = SkillInfo;
+	UCombatEventBusSubsystem::Publish(Caster, ECombatEventType::Fire, Caster, nullptr, Caster->GridCoord, FMath::RoundToInt(CachedDamage), SkillInfo);
+
+	// 입력 지연 추적: 스킬은 활성화 직후 판정 시퀀스에 들어가므로 Activate/Commit이 같은 지점
+	if (Caster->IsPlayerControlled())
+	{
+		FInputLatencyTracer::Mark(EInputLatencyStage::Activate);
+		FInputLatencyTracer::Mark(EInputLatencyStage::Commit);
+	}
 	ExecuteAttackSequence(Caster, SkillInfo);
 }
 
@@ -67,16 +82,26 @@ void UGA_SkillAttack::ExecuteAttackSequence(ACharacterBase* Caster, USkillBase*
 			// ★ [핵심 수정 1] 이미 이 몽타주를 재생 중인가? (준비 자세 루프 중인가?)
 			if (Caster->GetMesh() && Caster->GetMesh()->GetAnimInstance())
 			{
-				if (Caster->GetMesh()->GetAnimInstance()->Montage_IsPlaying(MontageToPlay))
+				if (Caster->GetMesh()->GetAnimInstance()->Montage_IsPlaying(MontageToPlay)
+					&& Enemy->GetAttackSections(MontageToPlay).HasSection(EMontageSection::AttackStart))
 				{
 					// 재생 중이라면 루프를 끊고 바로 "Attack_Start" 섹션부터 시작!
 					// 이렇게 하면 Ready -> Ready_Stay(Loop) -> Attack_Start 로 매끄럽게 이어집니다.
-					StartSectionName = FName("Attack_Start");
+					StartSectionName = GetMontageSectionName(EMontageSection::AttackStart);
 				}
 			}
 		}
 	}
 
+	// 즉시 판정 모드: Event.Skill.Hit 노티파이를 기다리지 않고 바로 판정, 몽타주는 연출로만 재생
+	if (UPortfolioGameInstance::IsInstantResolve(Caster))
+	{
+		ApplySkillEffects(Caster, SkillInfo);
+		PlayMontageVisualOnly(Caster, MontageToPlay, StartSectionName);
+		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
+		return;
+	}
+
 	// 3. 몽타주 검사
 	if (!MontageToPlay)
 	{
@@ -104,8 +129,8 @@ void UGA_SkillAttack::ExecuteAttackSequence(ACharacterBase* Caster, USkillBase*
 	PlayMontageTask->OnInterrupted.AddDynamic(this, &UGA_SkillAttack::OnMontageEnded);
 	PlayMontageTask->OnCancelled.AddDynamic(this, &UGA_SkillAttack::OnMontageEnded);
 
-	// 3. "Event.Skill.Hit" 노티파이 대기 태스크
-	FGameplayTag HitTag = FGameplayTag::RequestGameplayTag(TEXT("Event.Skill.Hit"));
+	// 3. "Event.Skill.Hit" 노티파이 대기 태스크 (태그 조회는 한 번만)
+	static const FGameplayTag HitTag = FGameplayTag::RequestGameplayTag(TEXT("Event.Skill.Hit"));
 	UAbilityTask_WaitGameplayEvent* WaitEventTask = UAbilityTask_WaitGameplayEvent::WaitGameplayEvent(
 		this, HitTag, nullptr, false, false
 	);
@@ -115,6 +140,44 @@ void UGA_SkillAttack::ExecuteAttackSequence(ACharacterBase* Caster, USkillBase*
 	// 태스크 활성화
 	WaitEventTask->ReadyForActivation();
 	PlayMontageTask->ReadyForActivation();
+
+	if (Caster->IsPlayerControlled())
+	{
+		FInputLatencyTracer::Mark(EInputLatencyStage::VisualStart);
+	}
+}
+
+void UGA_SkillAttack::PlayMontageVisualOnly(ACharacterBase* Caster, UAnimMontage* MontageToPlay, FName StartSectionName)
+{
+	UAnimInstance* AnimInst = (Caster && Caster->GetMesh()) ? Caster->GetMesh()->GetAnimInstance() : nullptr;
+	if (!MontageToPlay || !AnimInst) return;
+
+	Caster->SetAnimRootMotionTranslationScale(0.0f); // 제자리 고정
+
+	AnimInst->Montage_Play(MontageToPlay, 1.0f);
+	if (StartSectionName != NAME_None)
+	{
+		AnimInst->Montage_JumpToSection(StartSectionName, MontageToPlay);
+	}
+	// 판정은 이미 끝났으므로 건너뛰어도 안전
+	Caster->MarkMontageSkippable(MontageToPlay);
+
+	if (Caster->IsPlayerControlled())
+	{
+		FInputLatencyTracer::Mark(EInputLatencyStage::VisualStart);
+	}
+
+	// 어빌리티는 이미 끝났으므로 루트모션 복구만 몽타주 종료에 연결
+	TWeakObjectPtr<ACharacterBase> WeakCaster(Caster);
+	FOnMontageEnded EndDelegate;
+	EndDelegate.BindLambda([WeakCaster](UAnimMontage* Montage, bool bInterrupted)
+		{
+			if (WeakCaster.IsValid())
+			{
+				WeakCaster->SetAnimRootMotionTranslationScale(1.0f);
+			}
+		});
+	AnimInst->Montage_SetEndDelegate(EndDelegate, MontageToPlay);
 }
 
 // 애니메이션 종료 시 호출
@@ -145,9 +208,18 @@ void UGA_SkillAttack::OnMontageNotify(FGameplayEventData EventData)
 
 void UGA_SkillAttack::ApplySkillEffects(ACharacterBase* Caster, USkillBase* SkillInfo)
 {
+	BATTLE_LLM_SCOPE(SkillFX);
 	ABattleManager* BM = Caster->BattleManagerRef;
 	if (!BM) return;
 
+	BATTLE_PHASE_SCOPE(EBattlePhase::SkillResolution, BM, Caster);
+
+	// 스킬의 첫 화면 변화 = Hit 판정 (이펙트 스폰 + 데미지)
+	if (Caster->IsPlayerControlled())
+	{
+		FInputLatencyTracer::Mark(EInputLatencyStage::FirstMotion);
+	}
+
 	FIntPoint Origin = Caster->GridCoord;
 	EGridDirection Facing = Caster->FacingDirection;
 	float FinalDamage = (CachedDamage > 0.0f) ? CachedDamage : (float)SkillInfo->BaseDamage;
@@ -175,28 +247,14 @@ void UGA_SkillAttack::ApplySkillEffects(ACharacterBase* Caster, USkillBase* Skil
 	// ★ [설정] 이펙트 크기 (0.5f = 절반 크기)
 	FVector EffectScale = FVector(0.5f);
 
+	// 패턴 루프 중에는 데미지를 모으기만 함 (루프가 끝난 뒤 한 번에 판정)
+	FDamageBatch DamageBatch;
+
 	for (const FIntPoint& Point : SkillInfo->AttackPattern)
 	{
 		// ───────── [좌표 회전 계산] ─────────
-		// Point.X = 전방 거리, Point.Y = 우측 거리
-		int32 P_X = Point.X;
-		int32 P_Y = -Point.Y;
-
-		int32 RotatedX = 0;
-		int32 RotatedY = 0;
-
-		switch (Facing)
-		{
-		case EGridDirection::Right: // X+
-			RotatedX = P_X; RotatedY = P_Y; break;
-		case EGridDirection::Left:  // X-
-			RotatedX = -P_X; RotatedY = -P_Y; break;
-		case EGridDirection::Down:  // Y+
-			RotatedX = -P_Y; RotatedY = P_X; break;
-		case EGridDirection::Up:    // Y-
-			RotatedX = P_Y; RotatedY = -P_X; break;
-		}
-		FIntPoint TargetCoord = Origin + FIntPoint(RotatedX, RotatedY);
+		// Point.X = 전방 거리, Point.Y = 우측 거리 (위협 맵과 같은 회전 규칙)
+		FIntPoint TargetCoord = Origin + ACharacterBase::RotatePatternOffset(Point, Facing);
 		// ────────────────────────────────
 
 		// 1. [시각 효과] Cascade 파티클 스폰
@@ -218,19 +276,9 @@ void UGA_SkillAttack::ApplySkillEffects(ACharacterBase* Caster, USkillBase* Skil
 				EffectScale, // 크기 조절
 				true, true, ENCPoolMethod::None, true
 			);
-			// ★ [핵심] 타이머를 걸어서 강제로 죽여버림 (Infinite 루프 방지)
-			if (NiagComp)
-			{
-				FTimerHandle DestroyHandle;
-				GetWorld()->GetTimerManager().SetTimer(DestroyHandle, [NiagComp]()
-					{
-						if (IsValid(NiagComp))
-						{
-							NiagComp->Deactivate(); // 재생 중지
-							NiagComp->DestroyComponent(); // 컴포넌트 삭제
-						}
-					}, EffectLifeTime, false);
-			}
+			// ★ [핵심] 수명이 지나면 강제로 죽여버림 (Infinite 루프 방지)
+			// 이펙트마다 람다 타이머를 만들지 않고 BattleManager가 한 타이머로 일괄 정리
+			BM->RegisterTimedEffect(NiagComp, EffectLifeTime);
 		}
 
 		// 2순위: 나이아가라가 없고 Cascade만 있으면 Cascade 재생
@@ -253,7 +301,10 @@ void UGA_SkillAttack::ApplySkillEffects(ACharacterBase* Caster, USkillBase* Skil
 		// "대상이 존재하고" && "나 자신이 아닐 때"만 공격
 		if (TargetChar && TargetChar != Caster)
 		{
-			TargetChar->ApplyDamage(FinalDamage);
+			DamageBatch.Add(TargetChar, FinalDamage, Caster);
 		}
 	}
+
+	// 유닛별 합산 데미지 적용 -> 유닛당 체력 이벤트 1회 -> 사망 처리는 마지막
+	DamageBatch.Resolve();
 }
\ No newline at end of file
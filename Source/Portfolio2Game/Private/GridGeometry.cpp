@@ -0,0 +1,29 @@
+﻿#include "GridGeometry.h"
+#include "GridDataInterface.h"
+
+void FGridGeometry::Build(const AActor* GridActor)
+{
+	Reset();
+
+	if (!GridActor || !GridActor->GetClass()->ImplementsInterface(UGridDataInterface::StaticClass())) return;
+
+	// 인터페이스 호출은 여기서 한 번씩만 (BP 오버라이드 시 ProcessEvent 비용)
+	Width = IGridDataInterface::Execute_GetGridWidth(GridActor);
+	Height = IGridDataInterface::Execute_GetGridHeight(GridActor);
+	CellSizeX = IGridDataInterface::Execute_GetGridSizeX(GridActor);
+	CellSizeY = IGridDataInterface::Execute_GetGridSizeY(GridActor);
+	LocalOffset = IGridDataInterface::Execute_GetGridLocationOffset(GridActor);
+	GridTransform = GridActor->GetActorTransform();
+
+	if (!IsValid())
+	{
+		Width = Height = 0;
+		return;
+	}
+
+	CellWorldPositions.SetNumUninitialized(Num());
+	for (int32 Index = 0; Index < CellWorldPositions.Num(); ++Index)
+	{
+		CellWorldPositions[Index] = GridTransform.TransformPosition(CoordToLocal(IndexToCoord(Index)) + LocalOffset);
+	}
+}
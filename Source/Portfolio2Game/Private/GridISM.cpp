@@ -4,6 +4,8 @@
 #include "BattleManager.h"
 #include "CharacterBase.h"
 #include "Components/WidgetComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "BattleMemoryReport.h"
 
 AGridISM::AGridISM()
 {
@@ -12,6 +14,14 @@ AGridISM::AGridISM()
 	USceneComponent* DefaultSceneRoot = CreateDefaultSubobject<USceneComponent>(TEXT("DefaultSceneRoot"));
 	RootComponent = DefaultSceneRoot;
 
+	// ───────── [0] 타일 (ISM) ─────────
+	TileInstances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("TileInstances"));
+	TileInstances->SetupAttachment(RootComponent);
+	TileInstances->NumCustomDataFloats = static_cast<int32>(EGridTileState::Count);
+	TileInstances->SetCollisionEnabled(ECollisionEnabled::QueryOnly); // 마우스 트레이스용
+	TileInstances->SetGenerateOverlapEvents(false);
+	TileInstances->SetCastShadow(false);
+
 	// ───────── [1] 메인 카메라 (Main) ─────────
 	CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
 	CameraBoom->SetupAttachment(RootComponent);
@@ -72,6 +82,7 @@ AGridISM::AGridISM()
 void AGridISM::BeginPlay()
 {
 	Super::BeginPlay();
+	BATTLE_LLM_SCOPE(Grid);
 
 	// 1. HP바 미리 생성 (Object Pooling)
 	if (HPBarActorClass && GridWidth > 0 && GridHeight > 0)
@@ -132,6 +143,12 @@ void AGridISM::BeginPlay()
 		}
 	}
 
+	// 배치된 레벨에서는 OnConstruction이 다시 돌지 않으므로 상태 버퍼만 없으면 재생성
+	if (TileStateBits.Num() != GridWidth * GridHeight)
+	{
+		BuildTiles();
+	}
+
 	ActivateBattleCamera();
 
 	CachedBattleManager = Cast<ABattleManager>(
@@ -160,6 +177,113 @@ int32 AGridISM::GetGridIndexFromCoord_Implementation(FIntPoint Coord)
 	return (Coord.X * GridHeight) + Coord.Y; // Column-Major
 }
 
+// ───────── 타일 (네이티브 ISM) ─────────
+
+void AGridISM::BuildTiles()
+{
+	if (!TileInstances) return;
+	BATTLE_LLM_SCOPE(Grid);
+
+	TileInstances->ClearInstances();
+	TileStateBits.Reset();
+	HoveredTileIndex = INDEX_NONE;
+
+	if (!TileMesh || GridWidth <= 0 || GridHeight <= 0)
+	{
+		TileInstances->SetStaticMesh(nullptr);
+		return;
+	}
+
+	TileInstances->SetStaticMesh(TileMesh);
+	TileInstances->SetNumCustomDataFloats(static_cast<int32>(EGridTileState::Count));
+
+	const int32 TotalTiles = GridWidth * GridHeight;
+	const FVector Scale = TileScale * FVector(GridSizeX / 100.0, GridSizeY / 100.0, 1.0);
+
+	// 인스턴스 번호 = 그리드 인덱스 (Column-Major), BattleManager::GetWorldLocation과 같은 로컬 좌표
+	TArray<FTransform> Transforms;
+	Transforms.Reserve(TotalTiles);
+	for (int32 i = 0; i < TotalTiles; ++i)
+	{
+		const FIntPoint Coord = GetGridCoordFromIndex_Implementation(i);
+		const FVector LocalPos = FVector(Coord.X * GridSizeX, Coord.Y * GridSizeY, TileZOffset) + GridLocationOffset;
+		Transforms.Emplace(FQuat::Identity, LocalPos, Scale);
+	}
+
+	TileInstances->AddInstances(Transforms, false);
+	TileStateBits.SetNumZeroed(TotalTiles);
+}
+
+bool AGridISM::WriteTileState(int32 Index, EGridTileState State, bool bEnabled)
+{
+	if (!TileStateBits.IsValidIndex(Index)) return false;
+
+	const uint8 Bit = 1 << static_cast<uint8>(State);
+	if (((TileStateBits[Index] & Bit) != 0) == bEnabled) return false;
+
+	TileStateBits[Index] ^= Bit;
+	TileInstances->SetCustomDataValue(Index, static_cast<int32>(State), bEnabled ? 1.0f : 0.0f, false);
+	return true;
+}
+
+void AGridISM::SetTileState(int32 Index, EGridTileState State, bool bEnabled)
+{
+	if (WriteTileState(Index, State, bEnabled))
+	{
+		TileInstances->MarkRenderStateDirty();
+	}
+}
+
+void AGridISM::SetTileStates(const TArray<int32>& Indices, EGridTileState State, bool bEnabled, bool bExclusive)
+{
+	if (TileStateBits.Num() == 0) return;
+
+	bool bDirty = false;
+
+	if (bExclusive)
+	{
+		TBitArray<> InList(false, TileStateBits.Num());
+		for (int32 Index : Indices)
+		{
+			if (InList.IsValidIndex(Index)) InList[Index] = true;
+		}
+		for (int32 i = 0; i < TileStateBits.Num(); ++i)
+		{
+			if (!InList[i]) bDirty |= WriteTileState(i, State, false);
+		}
+	}
+
+	for (int32 Index : Indices)
+	{
+		bDirty |= WriteTileState(Index, State, bEnabled);
+	}
+
+	// 바뀐 칸이 있을 때만 인스턴스 버퍼 1회 갱신
+	if (bDirty)
+	{
+		TileInstances->MarkRenderStateDirty();
+	}
+}
+
+void AGridISM::ClearTileState(EGridTileState State)
+{
+	bool bDirty = false;
+	for (int32 i = 0; i < TileStateBits.Num(); ++i)
+	{
+		bDirty |= WriteTileState(i, State, false);
+	}
+
+	if (bDirty)
+	{
+		TileInstances->MarkRenderStateDirty();
+	}
+}
+
+bool AGridISM::GetTileState(int32 Index, EGridTileState State) const
+{
+	return TileStateBits.IsValidIndex(Index) && (TileStateBits[Index] & (1 << static_cast<uint8>(State))) != 0;
+}
+
 void AGridISM::UpdateTileHPBar(int32 Index, bool bShow, int32 CurrentHP, int32 MaxHP)
 {
 	if (!HPBarPool.IsValidIndex(Index)) return;
@@ -194,6 +318,16 @@ void AGridISM::VisibleGrid_Implementation(FVector GridLocation, FVector GridSize
 		int32 X = FMath::RoundToInt(LocalPos.X / GridSizeX);
 		int32 Y = FMath::RoundToInt(LocalPos.Y / GridSizeY);
 
+		// 호버 타일 갱신 (칸이 바뀔 때만)
+		const bool bInside = X >= 0 && X < GridWidth && Y >= 0 && Y < GridHeight;
+		const int32 NewHoverIndex = bInside ? GetGridIndexFromCoord_Implementation(FIntPoint(X, Y)) : INDEX_NONE;
+		if (NewHoverIndex != HoveredTileIndex)
+		{
+			SetTileState(HoveredTileIndex, EGridTileState::Hover, false);
+			SetTileState(NewHoverIndex, EGridTileState::Hover, true);
+			HoveredTileIndex = NewHoverIndex;
+		}
+
 		// 해당 칸에 있는 캐릭터 찾기
 		ACharacterBase* FoundChar = CachedBattleManager->GetCharacterAt(FIntPoint(X, Y));
 
@@ -220,6 +354,9 @@ void AGridISM::VisibleGrid_Implementation(FVector GridLocation, FVector GridSize
 
 void AGridISM::HiddenGrid_Implementation()
 {
+	SetTileState(HoveredTileIndex, EGridTileState::Hover, false);
+	HoveredTileIndex = INDEX_NONE;
+
 	// 하이라이트 끄기
 	if (LastHoveredCharacter)
 	{
@@ -232,6 +369,8 @@ void AGridISM::OnConstruction(const FTransform& Transform)
 {
 	Super::OnConstruction(Transform);
 
+	BuildTiles();
+
 	if (CameraBoom)
 	{
 		CameraBoom->bDoCollisionTest = false;
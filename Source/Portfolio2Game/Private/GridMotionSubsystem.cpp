@@ -0,0 +1,125 @@
+﻿#include "GridMotionSubsystem.h"
+#include "CharacterBase.h"
+#include "InputLatencyTracer.h"
+
+void UGridMotionSubsystem::StartMove(ACharacterBase* Character, const FVector& From, const FVector& To, float Duration)
+{
+	if (!Character) return;
+
+	int32 Index = Units.IndexOfByKey(Character);
+	if (Index == INDEX_NONE)
+	{
+		Index = Units.Add(Character);
+		Starts.AddUninitialized();
+		Dests.AddUninitialized();
+		Elapsed.AddUninitialized();
+		Durations.AddUninitialized();
+	}
+
+	Starts[Index] = From;
+	Dests[Index] = To;
+	Elapsed[Index] = 0.0f;
+	Durations[Index] = FMath::Max(Duration, KINDA_SMALL_NUMBER);
+}
+
+void UGridMotionSubsystem::CancelMove(ACharacterBase* Character)
+{
+	const int32 Index = Units.IndexOfByKey(Character);
+	if (Index != INDEX_NONE)
+	{
+		RemoveMoveAt(Index);
+	}
+}
+
+void UGridMotionSubsystem::FinishAllMoves()
+{
+	// Tick의 도착 처리와 같은 순서 (도착 처리 중 새로 등록된 이동은 건드리지 않음)
+	for (int32 i = Units.Num() - 1; i >= 0; --i)
+	{
+		ACharacterBase* Unit = Units[i];
+		const FVector Dest = Dests[i];
+		RemoveMoveAt(i);
+
+		if (IsValid(Unit))
+		{
+			Unit->SetActorLocation(Dest);
+			Unit->FinishVisualMove();
+		}
+	}
+}
+
+bool UGridMotionSubsystem::IsMoving(const ACharacterBase* Character) const
+{
+	return Units.Contains(Character);
+}
+
+void UGridMotionSubsystem::RemoveMoveAt(int32 Index)
+{
+	Units.RemoveAtSwap(Index, 1, false);
+	Starts.RemoveAtSwap(Index, 1, false);
+	Dests.RemoveAtSwap(Index, 1, false);
+	Elapsed.RemoveAtSwap(Index, 1, false);
+	Durations.RemoveAtSwap(Index, 1, false);
+}
+
+void UGridMotionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 뒤에서부터 진행 (도착한 유닛은 RemoveAtSwap, 도착 처리 중 새로 등록된 이동은 다음 프레임부터)
+	for (int32 i = Units.Num() - 1; i >= 0; --i)
+	{
+		ACharacterBase* Unit = Units[i];
+		if (!IsValid(Unit))
+		{
+			RemoveMoveAt(i);
+			continue;
+		}
+
+		// 액터 Tick과 같은 시간 기준 (즉시 판정 모드의 배속 포함)
+		Elapsed[i] += DeltaTime * Unit->CustomTimeDilation;
+		const float Alpha = FMath::Clamp(Elapsed[i] / Durations[i], 0.0f, 1.0f);
+
+		// 입력 지연 추적: 플레이어가 실제로 움직인 첫 프레임 (이미 기록됐으면 무시됨)
+		if (Unit->IsPlayerControlled())
+		{
+			FInputLatencyTracer::Mark(EInputLatencyStage::FirstMotion);
+		}
+
+		if (Alpha < 1.0f)
+		{
+			FVector NewLoc = FMath::Lerp(Starts[i], Dests[i], Alpha);
+			NewLoc.Z = Starts[i].Z;
+			Unit->SetActorLocation(NewLoc);
+			continue;
+		}
+
+		// 도착: 목록에서 먼저 빼고 위치 확정 후 도착 처리 (정지 몽타주, 턴 종료 타이머, HP바)
+		const FVector Dest = Dests[i];
+		RemoveMoveAt(i);
+
+		Unit->SetActorLocation(Dest);
+		Unit->FinishVisualMove();
+	}
+}
+
+bool UGridMotionSubsystem::IsTickable() const
+{
+	return Units.Num() > 0;
+}
+
+TStatId UGridMotionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGridMotionSubsystem, STATGROUP_Tickables);
+}
+
+void UGridMotionSubsystem::Deinitialize()
+{
+	Units.Empty();
+	Starts.Empty();
+	Dests.Empty();
+	Elapsed.Empty();
+	Durations.Empty();
+
+	Super::Deinitialize();
+}
@@ -0,0 +1,371 @@
+﻿#include "InputLatencyTracer.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Portfolio2Game.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Async/Async.h"
+#include "RenderingThread.h"
+
+namespace InputLatencyTracerPrivate
+{
+	static TAutoConsoleVariable<bool> CVarEnable(
+		TEXT("Battle.InputLatency.Enable"),
+		false,
+		TEXT("플레이어 입력 → 화면 반영 지연 추적을 켜거나 끕니다."));
+
+	// 명령 종류별 보관 샘플 수 (오래된 것부터 버림)
+	constexpr int32 MaxSamples = 256;
+
+	// FirstMotion까지 이 시간 안에 도달하지 못하면 추적 폐기 (이동 실패/턴 종료 등)
+	constexpr double OpenTraceTimeoutMs = 3000.0;
+
+	struct FLatencyTrace
+	{
+		EInputLatencyCommand Command = EInputLatencyCommand::Move;
+		uint64 StartCycles = 0;
+		uint64 StartFrame = 0;
+		uint32 Frames = 0;					// Input → FirstMotion 프레임 수
+		uint32 Generation = 0;				// Reset 이전에 출발한 렌더 완료 콜백 무시용
+		float QueueWaitMs = -1.0f;			// 버퍼된 명령의 누른 시각 ~ 실행 시각 (버퍼 안 됐으면 -1)
+		float StageMs[(int32)EInputLatencyStage::Count];
+
+		FLatencyTrace()
+		{
+			for (float& Ms : StageMs) Ms = -1.0f; // 미도달
+		}
+	};
+
+	static bool bTraceOpen = false;
+	static FLatencyTrace OpenTrace;
+	static uint32 Generation = 0;
+	static int32 DroppedCount = 0;
+	static TArray<FLatencyTrace> Samples[(int32)EInputLatencyCommand::Count];
+	static FDelegateHandle EndFrameHandle;
+
+	FORCEINLINE float ElapsedMs(uint64 StartCycles)
+	{
+		return (float)FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	static void CommitSample(const FLatencyTrace& Trace)
+	{
+		if (Trace.Generation != Generation) return;
+
+		TArray<FLatencyTrace>& Bucket = Samples[(int32)Trace.Command];
+		if (Bucket.Num() >= MaxSamples)
+		{
+			Bucket.RemoveAt(0);
+		}
+		Bucket.Add(Trace);
+
+		UE_LOG(LogBattle, VeryVerbose, TEXT("[InputLatency] %s: FirstMotion %.2fms (%u frame(s)), Rendered %.2fms"),
+			FInputLatencyTracer::GetCommandName(Trace.Command),
+			Trace.StageMs[(int32)EInputLatencyStage::FirstMotion], Trace.Frames,
+			Trace.StageMs[(int32)EInputLatencyStage::Rendered]);
+	}
+
+	// FirstMotion이 찍힌 프레임의 끝: 게임 스레드 시각 기록 후 렌더 스레드 완료를 기다림
+	static void OnEndFrame()
+	{
+		if (!bTraceOpen || OpenTrace.StageMs[(int32)EInputLatencyStage::FirstMotion] < 0.0f) return;
+
+		FLatencyTrace Trace = OpenTrace;
+		bTraceOpen = false;
+		Trace.StageMs[(int32)EInputLatencyStage::FrameEnd] = ElapsedMs(Trace.StartCycles);
+
+		// 이 프레임의 뷰 렌더링 명령 뒤에 들어가므로, 실행 시점 = 해당 프레임 렌더 스레드 처리 완료
+		ENQUEUE_RENDER_COMMAND(InputLatencyRendered)(
+			[Trace](FRHICommandListImmediate& RHICmdList) mutable
+			{
+				Trace.StageMs[(int32)EInputLatencyStage::Rendered] = ElapsedMs(Trace.StartCycles);
+				AsyncTask(ENamedThreads::GameThread, [Trace]()
+				{
+					CommitSample(Trace);
+				});
+			});
+	}
+
+	// 정렬된 값에서 백분위 (최근접 순위)
+	static float Percentile(const TArray<float>& Sorted, float P)
+	{
+		if (Sorted.Num() == 0) return 0.0f;
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(P * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+		return Sorted[Index];
+	}
+
+	struct FStageSummary
+	{
+		int32 Count = 0;
+		float P50 = 0.0f;
+		float P90 = 0.0f;
+		float P99 = 0.0f;
+		float Max = 0.0f;
+	};
+
+	static FStageSummary SummarizeValues(TArray<float>& Values)
+	{
+		Values.Sort();
+
+		FStageSummary Summary;
+		Summary.Count = Values.Num();
+		if (Values.Num() > 0)
+		{
+			Summary.P50 = Percentile(Values, 0.50f);
+			Summary.P90 = Percentile(Values, 0.90f);
+			Summary.P99 = Percentile(Values, 0.99f);
+			Summary.Max = Values.Last();
+		}
+		return Summary;
+	}
+
+	// 미도달 단계(-1)는 제외
+	static FStageSummary Summarize(EInputLatencyCommand Command, EInputLatencyStage Stage)
+	{
+		TArray<float> Values;
+		Values.Reserve(MaxSamples);
+		for (const FLatencyTrace& Trace : Samples[(int32)Command])
+		{
+			const float Ms = Trace.StageMs[(int32)Stage];
+			if (Ms >= 0.0f) Values.Add(Ms);
+		}
+		return SummarizeValues(Values);
+	}
+
+	static FStageSummary SummarizeQueueWait(EInputLatencyCommand Command)
+	{
+		TArray<float> Values;
+		Values.Reserve(MaxSamples);
+		for (const FLatencyTrace& Trace : Samples[(int32)Command])
+		{
+			if (Trace.QueueWaitMs >= 0.0f) Values.Add(Trace.QueueWaitMs);
+		}
+		return SummarizeValues(Values);
+	}
+
+	static FStageSummary SummarizeFrames(EInputLatencyCommand Command)
+	{
+		TArray<float> Values;
+		Values.Reserve(MaxSamples);
+		for (const FLatencyTrace& Trace : Samples[(int32)Command])
+		{
+			Values.Add((float)Trace.Frames);
+		}
+		return SummarizeValues(Values);
+	}
+}
+
+bool FInputLatencyTracer::IsEnabled()
+{
+	return InputLatencyTracerPrivate::CVarEnable.GetValueOnGameThread();
+}
+
+FInputLatencyStamp FInputLatencyTracer::Stamp()
+{
+	FInputLatencyStamp Result;
+	if (IsEnabled())
+	{
+		Result.Cycles = FPlatformTime::Cycles64();
+		Result.Frame = GFrameCounter;
+	}
+	return Result;
+}
+
+void FInputLatencyTracer::Begin(EInputLatencyCommand Command, const FInputLatencyStamp& InputStamp)
+{
+	using namespace InputLatencyTracerPrivate;
+	if (!IsEnabled()) return;
+
+	if (!EndFrameHandle.IsValid())
+	{
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&OnEndFrame);
+	}
+
+	// 화면 반영 전에 다음 명령이 들어왔으면 이전 추적은 버림
+	if (bTraceOpen)
+	{
+		DroppedCount++;
+	}
+
+	OpenTrace = FLatencyTrace();
+	OpenTrace.Command = Command;
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+	const bool bHasStamp = InputStamp.Cycles != 0;
+	if (bHasStamp && InputStamp.bBuffered)
+	{
+		// 턴을 기다린 시간은 따로 두고, 이후 단계는 실제 실행 시각부터
+		OpenTrace.QueueWaitMs = (float)FPlatformTime::ToMilliseconds64(NowCycles - InputStamp.Cycles);
+		OpenTrace.StartCycles = NowCycles;
+		OpenTrace.StartFrame = GFrameCounter;
+	}
+	else
+	{
+		OpenTrace.StartCycles = bHasStamp ? InputStamp.Cycles : NowCycles;
+		OpenTrace.StartFrame = bHasStamp ? InputStamp.Frame : GFrameCounter;
+	}
+	OpenTrace.Generation = Generation;
+	OpenTrace.StageMs[(int32)EInputLatencyStage::Input] = 0.0f;
+	bTraceOpen = true;
+}
+
+void FInputLatencyTracer::Mark(EInputLatencyStage Stage)
+{
+	using namespace InputLatencyTracerPrivate;
+	if (!bTraceOpen) return;
+
+	float& StageMs = OpenTrace.StageMs[(int32)Stage];
+	if (StageMs >= 0.0f) return;
+
+	const float Ms = ElapsedMs(OpenTrace.StartCycles);
+	if (Ms > OpenTraceTimeoutMs)
+	{
+		bTraceOpen = false;
+		DroppedCount++;
+		return;
+	}
+
+	StageMs = Ms;
+	if (Stage == EInputLatencyStage::FirstMotion)
+	{
+		OpenTrace.Frames = (uint32)(GFrameCounter - OpenTrace.StartFrame);
+	}
+}
+
+void FInputLatencyTracer::Dump(FOutputDevice& Ar)
+{
+	using namespace InputLatencyTracerPrivate;
+
+	Ar.Logf(TEXT("===== Input Latency (ms from input or buffered dispatch, Dropped %d) ====="), DroppedCount);
+	for (int32 c = 0; c < (int32)EInputLatencyCommand::Count; ++c)
+	{
+		const EInputLatencyCommand Command = (EInputLatencyCommand)c;
+		const FStageSummary Frames = SummarizeFrames(Command);
+		Ar.Logf(TEXT("----- %s (%d sample(s), FirstMotion frames p50 %.0f p99 %.0f) -----"),
+			GetCommandName(Command), Samples[c].Num(), Frames.P50, Frames.P99);
+
+		// 버퍼된 명령의 턴 대기 시간 (아래 단계 수치에는 포함되지 않음)
+		const FStageSummary Queue = SummarizeQueueWait(Command);
+		if (Queue.Count > 0)
+		{
+			Ar.Logf(TEXT("%-12s Count %4d  p50 %7.2f  p90 %7.2f  p99 %7.2f  Max %7.2f"),
+				TEXT("QueueWait"), Queue.Count, Queue.P50, Queue.P90, Queue.P99, Queue.Max);
+		}
+
+		for (int32 s = 1; s < (int32)EInputLatencyStage::Count; ++s)
+		{
+			const EInputLatencyStage Stage = (EInputLatencyStage)s;
+			const FStageSummary S = Summarize(Command, Stage);
+			if (S.Count == 0) continue;
+
+			Ar.Logf(TEXT("%-12s Count %4d  p50 %7.2f  p90 %7.2f  p99 %7.2f  Max %7.2f"),
+				GetStageName(Stage), S.Count, S.P50, S.P90, S.P99, S.Max);
+		}
+	}
+}
+
+bool FInputLatencyTracer::ExportCSV(const FString& FilePath)
+{
+	using namespace InputLatencyTracerPrivate;
+
+	FString Csv = TEXT("Command,Stage,Count,P50Ms,P90Ms,P99Ms,MaxMs\n");
+	for (int32 c = 0; c < (int32)EInputLatencyCommand::Count; ++c)
+	{
+		const EInputLatencyCommand Command = (EInputLatencyCommand)c;
+		for (int32 s = 1; s < (int32)EInputLatencyStage::Count; ++s)
+		{
+			const EInputLatencyStage Stage = (EInputLatencyStage)s;
+			const FStageSummary S = Summarize(Command, Stage);
+			Csv += FString::Printf(TEXT("%s,%s,%d,%.3f,%.3f,%.3f,%.3f\n"),
+				GetCommandName(Command), GetStageName(Stage), S.Count, S.P50, S.P90, S.P99, S.Max);
+		}
+
+		const FStageSummary Q = SummarizeQueueWait(Command);
+		Csv += FString::Printf(TEXT("%s,QueueWait,%d,%.3f,%.3f,%.3f,%.3f\n"),
+			GetCommandName(Command), Q.Count, Q.P50, Q.P90, Q.P99, Q.Max);
+
+		// 프레임 수는 Stage 칸에 Frames로 표기 (값 단위는 프레임)
+		const FStageSummary F = SummarizeFrames(Command);
+		Csv += FString::Printf(TEXT("%s,Frames,%d,%.0f,%.0f,%.0f,%.0f\n"),
+			GetCommandName(Command), F.Count, F.P50, F.P90, F.P99, F.Max);
+	}
+
+	return FFileHelper::SaveStringToFile(Csv, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8);
+}
+
+void FInputLatencyTracer::Reset()
+{
+	using namespace InputLatencyTracerPrivate;
+
+	bTraceOpen = false;
+	DroppedCount = 0;
+	Generation++; // 렌더 스레드에서 돌아오는 중인 샘플 무시
+	for (TArray<FLatencyTrace>& Bucket : Samples)
+	{
+		Bucket.Reset();
+	}
+}
+
+const TCHAR* FInputLatencyTracer::GetCommandName(EInputLatencyCommand Command)
+{
+	switch (Command)
+	{
+	case EInputLatencyCommand::Move:	return TEXT("Move");
+	case EInputLatencyCommand::Rotate:	return TEXT("Rotate");
+	case EInputLatencyCommand::Skill:	return TEXT("Skill");
+	default:							return TEXT("Unknown");
+	}
+}
+
+const TCHAR* FInputLatencyTracer::GetStageName(EInputLatencyStage Stage)
+{
+	switch (Stage)
+	{
+	case EInputLatencyStage::Input:			return TEXT("Input");
+	case EInputLatencyStage::Activate:		return TEXT("Activate");
+	case EInputLatencyStage::Commit:		return TEXT("Commit");
+	case EInputLatencyStage::VisualStart:	return TEXT("VisualStart");
+	case EInputLatencyStage::FirstMotion:	return TEXT("FirstMotion");
+	case EInputLatencyStage::FrameEnd:		return TEXT("FrameEnd");
+	case EInputLatencyStage::Rendered:		return TEXT("Rendered");
+	default:								return TEXT("Unknown");
+	}
+}
+
+// ───────── 콘솔 명령 ─────────
+
+static FAutoConsoleCommand InputLatencyDumpCmd(
+	TEXT("Battle.InputLatency.Dump"),
+	TEXT("명령 종류별 입력 → 화면 반영 지연 백분위(p50/p90/p99)를 출력합니다."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		FInputLatencyTracer::Dump(Ar);
+	}));
+
+static FAutoConsoleCommand InputLatencyExportCmd(
+	TEXT("Battle.InputLatency.ExportCSV"),
+	TEXT("입력 지연 백분위를 CSV로 저장합니다. 인자가 없으면 Saved/Profiling/InputLatency-<시각>.csv"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FString FilePath = (Args.Num() > 0)
+			? Args[0]
+			: FPaths::ProfilingDir() / FString::Printf(TEXT("InputLatency-%s.csv"), *FDateTime::Now().ToString());
+
+		if (FInputLatencyTracer::ExportCSV(FilePath))
+		{
+			UE_LOG(LogBattle, Log, TEXT("[InputLatency] Exported -> %s"), *FilePath);
+		}
+		else
+		{
+			UE_LOG(LogBattle, Error, TEXT("[InputLatency] CSV export failed: %s"), *FilePath);
+		}
+	}));
+
+static FAutoConsoleCommand InputLatencyResetCmd(
+	TEXT("Battle.InputLatency.Reset"),
+	TEXT("입력 지연 기록을 초기화합니다."),
+	FConsoleCommandDelegate::CreateStatic(&FInputLatencyTracer::Reset));
+
+#endif // !UE_BUILD_SHIPPING
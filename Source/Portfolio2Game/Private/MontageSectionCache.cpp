@@ -0,0 +1,45 @@
+﻿#include "MontageSectionCache.h"
+#include "Animation/AnimMontage.h"
+
+const FName& GetMontageSectionName(EMontageSection Section)
+{
+	static const FName Names[(int32)EMontageSection::Count] =
+	{
+		FName(TEXT("Default")),
+		FName(TEXT("Ready")),
+		FName(TEXT("Attack_Start")),
+		FName(TEXT("Hit")),
+		FName(TEXT("Death")),
+	};
+
+	check(Section < EMontageSection::Count);
+	return Names[(int32)Section];
+}
+
+void FMontageSectionCache::Build(const UAnimMontage* InMontage)
+{
+	Montage = InMontage;
+
+	for (int32 i = 0; i < (int32)EMontageSection::Count; ++i)
+	{
+		Indices[i] = INDEX_NONE;
+		Lengths[i] = 0.0f;
+
+		if (!InMontage) continue;
+
+		const int32 SectionIndex = InMontage->GetSectionIndex(GetMontageSectionName((EMontageSection)i));
+		if (SectionIndex != INDEX_NONE)
+		{
+			Indices[i] = SectionIndex;
+			Lengths[i] = InMontage->GetSectionLength(SectionIndex);
+		}
+	}
+}
+
+void FMontageSectionCache::EnsureBuilt(const UAnimMontage* InMontage)
+{
+	if (Montage != InMontage)
+	{
+		Build(InMontage);
+	}
+}
@@ -1,6 +1,13 @@
 ﻿// PlayerCharacter.cpp
 
 #include "PlayerCharacter.h"
+#include "Portfolio2Game.h"
+#include "BattlePhaseMonitor.h"
+#include "InputLatencyTracer.h"
+#include "BattleGCSubsystem.h"
+#include "BattleMemoryReport.h"
+#include "BattleHUDViewModel.h"
+#include "CombatEventBusSubsystem.h"
 #include "BattleManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "PortfolioGameInstance.h"
@@ -27,6 +34,16 @@ void APlayerCharacter::StartAction()
 	bHasCommittedAction = false;
 
 	SetInputEnabled(true);
+
+	// 턴 직전에 눌러둔 이동/회전이 있으면 바로 실행
+	// 지연 추적은 여기(실행 시각)부터, 누른 뒤 턴을 기다린 시간은 QueueWait로 따로 기록
+	FInputLatencyStamp BufferedStamp;
+	const EPlayerCommand Buffered = InputRouter.ConsumeBuffered(GetWorld()->GetTimeSeconds(), InputBufferWindow, BufferedStamp);
+	if (Buffered != EPlayerCommand::None && CanAcceptCommand())
+	{
+		UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("[Input] Buffered command %d executed at turn start"), (int32)Buffered);
+		ExecuteCommand(Buffered, BufferedStamp);
+	}
 }
 
 void APlayerCharacter::EndAction()
@@ -62,7 +79,7 @@ void APlayerCharacter::PossessedBy(AController* NewController)
 
 				int32 CurrentHP = FMath::RoundToInt(GI->SavedCurrentHP);
 				int32 MaxHP = FMath::RoundToInt(GI->SavedMaxHP);
-				OnHealthChanged.Broadcast(CurrentHP, MaxHP);
+				NotifyHealthChanged(CurrentHP, MaxHP);
 			}
 			OwnedSkills = GI->SavedSkills;
 
@@ -78,6 +95,9 @@ void APlayerCharacter::PossessedBy(AController* NewController)
 		}
 	}
 
+	BroadcastHealthChanged();
+	SyncHUDSkillState();
+
 	// 3. 입력 설정 & ★ 마우스 무조건 켜기 (통합) ★
 	APlayerController* PC = Cast<APlayerController>(NewController);
 	if (PC)
@@ -100,7 +120,7 @@ void APlayerCharacter::PossessedBy(AController* NewController)
 	PC->SetInputMode(InputMode);
 
 	// 상태 초기화
-	bInputLocked = false;
+	InputRouter.Reset();
 	bHasCommittedAction = false;
 }
 
@@ -161,146 +181,182 @@ void APlayerCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCom
 
 void APlayerCharacter::SetInputEnabled(bool bEnabled)
 {
-	if (APlayerController* PC = Cast<APlayerController>(GetController()))
+	// 매핑 컨텍스트는 PossessedBy에서 한 번만 추가하고 유지 (턴마다 재구성하지 않음)
+	if (bEnabled)
 	{
-		if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer()))
+		InputRouter.Open();
+	}
+	else
+	{
+		InputRouter.Close();
+	}
+}
+
+// ───────── 입력 라우터 ─────────
+
+bool APlayerCharacter::CanAcceptCommand() const
+{
+	return bCanAct && !bIsSkillQueueRunning && !bHasCommittedAction && !IsInputLocked();
+}
+
+bool APlayerCharacter::IsInputLocked() const
+{
+	return InputRouter.IsLocked(GetWorld()->GetTimeSeconds());
+}
+
+void APlayerCharacter::RouteCommand(EPlayerCommand Command)
+{
+	// Input_* 핸들러에서 바로 불리므로 여기가 누른 시각
+	const FInputLatencyStamp InputStamp = FInputLatencyTracer::Stamp();
+
+	// 내 턴이 아니면 보관했다가 StartAction에서 실행 (턴 직전 입력을 버리지 않음)
+	if (!InputRouter.IsOpen())
+	{
+		const bool bBattleRunning = BattleManagerRef
+			&& BattleManagerRef->CurrentState != EBattleState::Victory
+			&& BattleManagerRef->CurrentState != EBattleState::Defeat;
+
+		if (!bDead && bBattleRunning)
 		{
-			if (bEnabled)
-			{
-				// 중복 방지를 위해 일단 지웠다 추가 (안전빵)
-				Subsystem->RemoveMappingContext(PlayerMoveContext);
-				Subsystem->AddMappingContext(PlayerMoveContext, 1);
-			}
-			else
-			{
-				Subsystem->RemoveMappingContext(PlayerMoveContext);
-			}
+			InputRouter.Buffer(Command, GetWorld()->GetTimeSeconds(), InputStamp);
 		}
+		return;
 	}
+
+	if (!CanAcceptCommand()) return;
+	ExecuteCommand(Command, InputStamp);
 }
 
-// (기존) 입력 래퍼 함수 구현 
-void APlayerCharacter::Input_MoveUp()
+void APlayerCharacter::ExecuteCommand(EPlayerCommand Command, const FInputLatencyStamp& InputStamp)
 {
-	if (bIsSkillQueueRunning) return;
-	if (!bCanAct || bInputLocked || bHasCommittedAction) return;
-	if (AbilitySystem)
+	BATTLE_PHASE_SCOPE(EBattlePhase::PlayerInput, BattleManagerRef, this);
+
+	int32 MoveInputID = PlayerAbilityInputID::None;
+	EGridDirection NewDir = FacingDirection;
+	UAnimMontage* RotateMontage = nullptr;
+
+	switch (Command)
+	{
+	case EPlayerCommand::MoveUp:	MoveInputID = PlayerAbilityInputID::MoveUp; break;
+	case EPlayerCommand::MoveDown:	MoveInputID = PlayerAbilityInputID::MoveDown; break;
+	case EPlayerCommand::MoveLeft:	MoveInputID = PlayerAbilityInputID::MoveLeft; break;
+	case EPlayerCommand::MoveRight:	MoveInputID = PlayerAbilityInputID::MoveRight; break;
+
+	// Q: 반시계 회전 (Right -> Up -> Left -> Down)
+	case EPlayerCommand::RotateCCW:
+		switch (FacingDirection)
+		{
+		case EGridDirection::Right: NewDir = EGridDirection::Up; break;
+		case EGridDirection::Up:    NewDir = EGridDirection::Left; break;
+		case EGridDirection::Left:  NewDir = EGridDirection::Down; break;
+		case EGridDirection::Down:  NewDir = EGridDirection::Right; break;
+		}
+		RotateMontage = Montage_RotateCCW;
+		break;
+
+	// E: 시계 회전 (Right -> Down -> Left -> Up)
+	case EPlayerCommand::RotateCW:
+		switch (FacingDirection)
+		{
+		case EGridDirection::Right: NewDir = EGridDirection::Down; break;
+		case EGridDirection::Down:  NewDir = EGridDirection::Left; break;
+		case EGridDirection::Left:  NewDir = EGridDirection::Up; break;
+		case EGridDirection::Up:    NewDir = EGridDirection::Right; break;
+		}
+		RotateMontage = Montage_RotateCW;
+		break;
+
+	// R: 뒤로 돌기
+	case EPlayerCommand::Rotate180:
+		switch (FacingDirection)
+		{
+		case EGridDirection::Right: NewDir = EGridDirection::Left; break;
+		case EGridDirection::Left:  NewDir = EGridDirection::Right; break;
+		case EGridDirection::Up:    NewDir = EGridDirection::Down; break;
+		case EGridDirection::Down:  NewDir = EGridDirection::Up; break;
+		}
+		RotateMontage = Montage_Rotate180;
+		break;
+
+	default:
+		return;
+	}
+
+	FInputLatencyTracer::Begin(MoveInputID != PlayerAbilityInputID::None ? EInputLatencyCommand::Move : EInputLatencyCommand::Rotate, InputStamp);
+
+	// 이동은 GA_Move가 검증을 통과한 뒤에 GC 행동 구간 시작 (막힌 이동은 EndAction이 오지 않음)
+	if (MoveInputID != PlayerAbilityInputID::None)
 	{
-		bHasCommittedAction = true;
-		AbilitySystem->AbilityLocalInputPressed(PlayerAbilityInputID::MoveUp);
-		LockInputTemporarily();
+		if (AbilitySystem)
+		{
+			bHasCommittedAction = true;
+			AbilitySystem->AbilityLocalInputPressed(MoveInputID);
+			LockInputTemporarily();
+		}
+		return;
 	}
+
+	// 몽타주와 함께 요청 (없으면 즉시 회전). 회전은 항상 EndAction까지 진행
+	UBattleGCSubsystem::BeginActionPlayback(this);
+	RequestRotation(NewDir, RotateMontage);
+	bHasCommittedAction = true;
+}
+
+// (기존) 입력 래퍼 함수 구현 -> 전부 라우터로
+void APlayerCharacter::Input_MoveUp()
+{
+	RouteCommand(EPlayerCommand::MoveUp);
 }
 
 void APlayerCharacter::Input_MoveDown()
 {
-	if (bIsSkillQueueRunning) return;
-	if (!bCanAct || bInputLocked || bHasCommittedAction) return;	if (AbilitySystem)
-	{
-		bHasCommittedAction = true;
-		AbilitySystem->AbilityLocalInputPressed(PlayerAbilityInputID::MoveDown);
-		LockInputTemporarily();
-	}
+	RouteCommand(EPlayerCommand::MoveDown);
 }
 
 void APlayerCharacter::Input_MoveLeft()
 {
-	if (bIsSkillQueueRunning) return;
-	if (!bCanAct || bInputLocked || bHasCommittedAction) return;	if (AbilitySystem)
-	{
-		bHasCommittedAction = true;
-		AbilitySystem->AbilityLocalInputPressed(PlayerAbilityInputID::MoveLeft);
-		LockInputTemporarily();
-	}
+	RouteCommand(EPlayerCommand::MoveLeft);
 }
 
 void APlayerCharacter::Input_MoveRight()
 {
-	if (bIsSkillQueueRunning) return;
-	if (!bCanAct || bInputLocked || bHasCommittedAction) return;	if (AbilitySystem)
-	{
-		bHasCommittedAction = true;
-		AbilitySystem->AbilityLocalInputPressed(PlayerAbilityInputID::MoveRight);
-		LockInputTemporarily();
-	}
+	RouteCommand(EPlayerCommand::MoveRight);
 }
 
-// Q: 반시계 회전 (Right -> Up -> Left -> Down)
 void APlayerCharacter::Input_RotateCCW()
 {
-	if (!bCanAct || bInputLocked || bHasCommittedAction) return;
-	EGridDirection NewDir = FacingDirection;
-	switch (FacingDirection)
-	{
-	case EGridDirection::Right: NewDir = EGridDirection::Up; break;
-	case EGridDirection::Up:    NewDir = EGridDirection::Left; break;
-	case EGridDirection::Left:  NewDir = EGridDirection::Down; break;
-	case EGridDirection::Down:  NewDir = EGridDirection::Right; break;
-	}
-
-	// 몽타주와 함께 요청 (없으면 즉시 회전)
-	RequestRotation(NewDir, Montage_RotateCCW);
-	bHasCommittedAction = true;
+	RouteCommand(EPlayerCommand::RotateCCW);
 }
 
-// E: 시계 회전 (Right -> Down -> Left -> Up)
 void APlayerCharacter::Input_RotateCW()
 {
-	if (!bCanAct || bInputLocked || bHasCommittedAction) return;
-	EGridDirection NewDir = FacingDirection;
-	switch (FacingDirection)
-	{
-	case EGridDirection::Right: NewDir = EGridDirection::Down; break;
-	case EGridDirection::Down:  NewDir = EGridDirection::Left; break;
-	case EGridDirection::Left:  NewDir = EGridDirection::Up; break;
-	case EGridDirection::Up:    NewDir = EGridDirection::Right; break;
-	}
-
-	RequestRotation(NewDir, Montage_RotateCW);
-	bHasCommittedAction = true;
+	RouteCommand(EPlayerCommand::RotateCW);
 }
 
-// R: 뒤로 돌기
 void APlayerCharacter::Input_Rotate180()
 {
-	if (!bCanAct || bInputLocked || bHasCommittedAction) return;
-	EGridDirection NewDir = FacingDirection;
-	switch (FacingDirection)
-	{
-	case EGridDirection::Right: NewDir = EGridDirection::Left; break;
-	case EGridDirection::Left:  NewDir = EGridDirection::Right; break;
-	case EGridDirection::Up:    NewDir = EGridDirection::Down; break;
-	case EGridDirection::Down:  NewDir = EGridDirection::Up; break;
-	}
-
-	RequestRotation(NewDir, Montage_Rotate180);
-	bHasCommittedAction = true;
+	RouteCommand(EPlayerCommand::Rotate180);
 }
 
 void APlayerCharacter::Input_DebugStageClear()
 {
 	if (BattleManagerRef)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[Debug] Force Stage Clear!"));
+		UE_LOG(LogBattle, Log, TEXT("[Debug] Force Stage Clear!"));
 		BattleManagerRef->ForceStageClear();
 	}
 }
 
 void APlayerCharacter::LockInputTemporarily()
 {
-	bInputLocked = true;
-	GetWorld()->GetTimerManager().SetTimer(InputLockTimerHandle, this,
-		&APlayerCharacter::UnlockInput, InputCooldown, false);
-}
-
-void APlayerCharacter::UnlockInput()
-{
-	bInputLocked = false;
+	// 타이머 없이 해제 시각만 기록
+	InputRouter.Lock(GetWorld()->GetTimeSeconds(), InputCooldown);
 }
 
 void APlayerCharacter::SelectSkill(int32 SkillIndex)
 {
-	if (!bCanAct || bInputLocked) return;
+	BATTLE_PHASE_SCOPE(EBattlePhase::PlayerInput, BattleManagerRef, this);
+	if (!bCanAct || IsInputLocked()) return;
 	if (BattleManagerRef && BattleManagerRef->CurrentState != EBattleState::PlayerTurn)
 	{
 		return;
@@ -310,14 +366,14 @@ void APlayerCharacter::SelectSkill(int32 SkillIndex)
 	// (★수정★) 인덱스 유효성 검사
 	if (!OwnedSkills.IsValidIndex(SkillIndex))
 	{
-		UE_LOG(LogTemp, Error, TEXT("SelectSkill: 잘못된 인덱스(%d)입니다."), SkillIndex);
+		UE_LOG(LogBattle, Error, TEXT("SelectSkill: 잘못된 인덱스(%d)입니다."), SkillIndex);
 		return;
 	}
 
 	// (★수정★) 쿨타임 검사 (인덱스 기반)
 	if (OwnedSkills[SkillIndex].CurrentCooldown > 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SelectSkill: %s (인덱스 %d)는 쿨타임 중입니다."), *OwnedSkills[SkillIndex].GetSkillName().ToString(), SkillIndex);
+		UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("SelectSkill: %s (인덱스 %d)는 쿨타임 중입니다."), *OwnedSkills[SkillIndex].GetSkillName().ToString(), SkillIndex);
 		return;
 	}
 
@@ -327,11 +383,13 @@ void APlayerCharacter::SelectSkill(int32 SkillIndex)
 
 	// (★수정★) UI 큐에 '인덱스' 추가
 	SkillQueueIndices.Add(SkillIndex);
+	SyncHUDSkillState();
 
 	// (유지) UI 큐 시각화용 이벤트는 SkillInfo 애셋을 보냄 (아이콘 표시용)
 	OnSkillSelected_BPEvent.Broadcast(OwnedSkills[SkillIndex].SkillInfo);
+	RefreshSkillQueuePreview();
 
-	UE_LOG(LogTemp, Warning, TEXT("%s (인덱스 %d) 스킬 선택됨 (현재 %d개)"), *OwnedSkills[SkillIndex].GetSkillName().ToString(), SkillIndex, SkillQueueIndices.Num());
+	UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("%s (인덱스 %d) 스킬 선택됨 (현재 %d개)"), *OwnedSkills[SkillIndex].GetSkillName().ToString(), SkillIndex, SkillQueueIndices.Num());
 
 	LockInputTemporarily();
 	EndAction();
@@ -341,6 +399,7 @@ void APlayerCharacter::SelectSkill(int32 SkillIndex)
 void APlayerCharacter::ClearSkillQueue()
 {
 	SkillQueueIndices.Empty();
+	SyncHUDSkillState();
 }
 
 // 모든 스킬 쿨타임 감소
@@ -353,6 +412,7 @@ void APlayerCharacter::ReduceCooldowns()
 
 
 	}
+	SyncHUDSkillState();
 }
 
 // 스킬 사용 시 쿨타임 적용
@@ -361,20 +421,32 @@ void APlayerCharacter::ApplySkillCooldown(int32 SkillIndex)
 	// (★수정★)
 	if (!OwnedSkills.IsValidIndex(SkillIndex))
 	{
-		UE_LOG(LogTemp, Error, TEXT("ApplySkillCooldown: 잘못된 인덱스(%d)입니다."), SkillIndex);
+		UE_LOG(LogBattle, Error, TEXT("ApplySkillCooldown: 잘못된 인덱스(%d)입니다."), SkillIndex);
 		return;
 	}
 
 	FPlayerSkillData& SkillData = OwnedSkills[SkillIndex];
 	SkillData.CurrentCooldown = SkillData.GetEffectiveTotalCooldown();
 
-	UE_LOG(LogTemp, Warning, TEXT("ApplyCooldown: %s (인덱스 %d)에 쿨타임 %d 적용됨"), *SkillData.GetSkillName().ToString(), SkillIndex, SkillData.CurrentCooldown);
+	UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("ApplyCooldown: %s (인덱스 %d)에 쿨타임 %d 적용됨"), *SkillData.GetSkillName().ToString(), SkillIndex, SkillData.CurrentCooldown);
+	SyncHUDSkillState(); // 큐에서 빠진 것도 함께 반영
+}
+
+void APlayerCharacter::SyncHUDSkillState()
+{
+	if (UBattleHUDViewModel* HUD = UBattleHUDViewModel::Get(this))
+	{
+		HUD->SetSkillCooldowns(OwnedSkills);
+		HUD->SetSkillQueue(SkillQueueIndices);
+	}
 }
 
 void APlayerCharacter::Input_ExecuteSkills()
 {
+	const FInputLatencyStamp InputStamp = FInputLatencyTracer::Stamp();
+	BATTLE_PHASE_SCOPE(EBattlePhase::PlayerInput, BattleManagerRef, this);
 	if (bIsSkillQueueRunning) return;
-	if (bInputLocked || !bCanAct) return; // 행동 불가시 무시
+	if (IsInputLocked() || !bCanAct) return; // 행동 불가시 무시
 	if (SkillQueueIndices.Num() == 0) return; // 큐가 비었으면 무시
 
 	if (GetWorld()->GetTimerManager().IsTimerActive(SkillQueueTimerHandle))
@@ -382,12 +454,15 @@ void APlayerCharacter::Input_ExecuteSkills()
 		return;
 	}
 
+	FInputLatencyTracer::Begin(EInputLatencyCommand::Skill, InputStamp);
+	UBattleGCSubsystem::BeginActionPlayback(this);
+
 	bIsSkillQueueRunning = true;
 
 	bHasCommittedAction = true;
 	LockInputTemporarily(); // 입력 잠금.
 
-	UE_LOG(LogTemp, Warning, TEXT("=== 스킬 큐 실행 시작 ==="));
+	UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("=== 스킬 큐 실행 시작 ==="));
 
 	ExecuteNextSkillInQueue_UI(); // 0.2초 딜레이 시퀀스 시작
 }
@@ -395,29 +470,46 @@ void APlayerCharacter::Input_ExecuteSkills()
 void APlayerCharacter::Input_CancelSkills()
 {
 	if (bIsSkillQueueRunning) return;
-	if (bInputLocked || !bCanAct) return;
+	if (IsInputLocked() || !bCanAct) return;
 	if (SkillQueueIndices.Num() == 0) return;
 
 	GetWorld()->GetTimerManager().ClearTimer(SkillQueueTimerHandle);
 	ClearSkillQueue();
 
-	UE_LOG(LogTemp, Warning, TEXT("모든 스킬 큐가 취소되었습니다."));
+	UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("모든 스킬 큐가 취소되었습니다."));
 
 	OnSkillQueueCleared_BPEvent.Broadcast();
+	RefreshSkillQueuePreview();
 
 	LockInputTemporarily();
 }
 
+void APlayerCharacter::RefreshSkillQueuePreview()
+{
+	SkillQueuePreview = FSkillQueuePreview::Build(this);
+	OnSkillQueuePreviewUpdated.Broadcast(SkillQueuePreview);
+}
+
+void APlayerCharacter::OnGridStateChanged()
+{
+	// 실행 중에는 큐가 하나씩 빠지므로 미리보기 고정
+	if (HasQueuedSkill() && !bIsSkillQueueRunning)
+	{
+		RefreshSkillQueuePreview();
+	}
+}
+
 void APlayerCharacter::ExecuteNextSkillInQueue_UI()
 {
 	// 1. 큐가 비었으면 진짜로 종료 (타이머 타고 들어온 마지막 호출)
 	if (SkillQueueIndices.Num() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("=== 스킬 큐 실행 완료 ==="));
+		UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("=== 스킬 큐 실행 완료 ==="));
 		GetWorld()->GetTimerManager().ClearTimer(SkillQueueTimerHandle);
 		OnSkillQueueCleared_BPEvent.Broadcast(); // UI 큐 비우기 신호
 
 		bIsSkillQueueRunning = false;
+		RefreshSkillQueuePreview(); // 빈 미리보기로 정리
 		EndAction(); // 턴 종료
 		return;
 	}
@@ -439,7 +531,8 @@ void APlayerCharacter::ExecuteNextSkillInQueue_UI()
 	// 필수 체크
 	if (!GenericAttackAbilityClass || !SkillData.SkillInfo)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR: 데이터 누락"));
+		UE_LOG(LogBattle, Error, TEXT("ERROR: 데이터 누락"));
+		UBattleGCSubsystem::EndActionPlayback(this, 0.0f); // EndAction이 오지 않으므로 GC 보류 해제
 		return;
 	}
 
@@ -452,6 +545,9 @@ void APlayerCharacter::ExecuteNextSkillInQueue_UI()
 		AnimDuration = SkillData.SkillInfo->SkillMontage->GetPlayLength() + 0.3f;
 	}
 
+	// 즉시 판정 모드: 데미지는 GA에서 바로 적용되므로 몽타주 길이를 기다리지 않음
+	AnimDuration = UPortfolioGameInstance::GetTurnStepDelay(this, AnimDuration);
+
 	bool bSuccess = false;
 
 	// 3. GAS 실행
@@ -469,7 +565,7 @@ void APlayerCharacter::ExecuteNextSkillInQueue_UI()
 			Payload.Target = this;
 			Payload.EventMagnitude = FinalDmg; // <-- 여기에 데미지 전달
 
-			FGameplayTag TriggerTag = FGameplayTag::RequestGameplayTag(TEXT("Ability.Skill.Attack"));
+			static const FGameplayTag TriggerTag = FGameplayTag::RequestGameplayTag(TEXT("Ability.Skill.Attack"));
 
 			AbilitySystem->TriggerAbilityFromGameplayEvent(
 				Spec->Handle,
@@ -485,11 +581,11 @@ void APlayerCharacter::ExecuteNextSkillInQueue_UI()
 
 	if (bSuccess)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SKILL FIRED: %s (Duration: %.2f)"), *SkillData.GetSkillName().ToString(), AnimDuration);
+		UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("SKILL FIRED: %s (Duration: %.2f)"), *SkillData.GetSkillName().ToString(), AnimDuration);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("SKILL FIRED FAILED"));
+		UE_LOG(LogBattle, Warning, TEXT("SKILL FIRED FAILED"));
 	}
 
 	// 4. 쿨타임 적용
@@ -534,6 +630,7 @@ void APlayerCharacter::Input_Pause()
 		// 2. UI 띄우기
 		if (!PauseMenuInstance)
 		{
+			BATTLE_LLM_SCOPE(UI);
 			PauseMenuInstance = CreateWidget<UUserWidget>(GetWorld(), PauseMenuWidgetClass);
 		}
 
@@ -574,7 +671,7 @@ void APlayerCharacter::Test_InstantlyDie()
 		AbilitySystem->SetNumericAttributeBase(UBaseAttributeSet::GetHPAttribute(), 0.0f);
 
 		// SetNumericAttributeBase()는 변경 델리게이트를 발생시키므로
-		// OnHealthChanged_Wrapper -> OnDeath() 로직이 실행됩니다.
+		// HandleHealthChanged -> OnDeath() 로직이 실행됩니다.
 
 		UE_LOG(LogTemp, Log, TEXT("Player HP set to 0.0f via ASC. Triggering Death Logic."));
 	}
@@ -611,6 +708,7 @@ void APlayerCharacter::ResumeGame()
 
 void APlayerCharacter::Die()
 {
+	UCombatEventBusSubsystem::Publish(this, ECombatEventType::Death, this, nullptr, GridCoord);
 
 	// 2. 입력 차단
 	if (APlayerController* PC = Cast<APlayerController>(GetController()))
@@ -620,11 +718,11 @@ void APlayerCharacter::Die()
 
 	if (StateMontage)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Die() 호출됨! 몽타주 있음: %s"), *StateMontage->GetName());
+		UE_LOG_BATTLE_UNIT(this, Verbose, TEXT("Die() 호출됨! 몽타주 있음: %s"), *StateMontage->GetName());
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("Die() 호출됨! 하지만 StateMontage가 비어있음(Null)! BP를 확인하세요."));
+		UE_LOG(LogBattle, Error, TEXT("Die() 호출됨! 하지만 StateMontage가 비어있음(Null)! BP를 확인하세요."));
 	}
 
 	float DeathDuration = 2.0f; // 몽타주 없을 때를 대비한 기본값
@@ -638,21 +736,22 @@ void APlayerCharacter::Die()
 		AnimInst->Montage_Play(StateMontage);
 
 		// 'Death' 섹션으로 즉시 이동
-		AnimInst->Montage_JumpToSection(FName("Death"), StateMontage);
+		AnimInst->Montage_JumpToSection(GetMontageSectionName(EMontageSection::Death), StateMontage);
 
 		// ★ [핵심] 'Death' 섹션이 끝나면 다음으로 넘어가지 말고 멈추게 설정
-		AnimInst->Montage_SetNextSection(FName("Death"), FName("None"), StateMontage);
+		AnimInst->Montage_SetNextSection(GetMontageSectionName(EMontageSection::Death), NAME_None, StateMontage);
 
-		// ★ [핵심] 'Death' 섹션의 정확한 길이 계산
-		int32 SectionIndex = StateMontage->GetSectionIndex(FName("Death"));
-		if (SectionIndex != INDEX_NONE)
+		// ★ [핵심] 'Death' 섹션의 정확한 길이 계산 (섹션 캐시 사용)
+		StateSections.EnsureBuilt(StateMontage);
+		if (StateSections.HasSection(EMontageSection::Death))
 		{
-			DeathDuration = StateMontage->GetSectionLength(SectionIndex);
+			DeathDuration = StateSections.GetLength(EMontageSection::Death);
 			DeathDuration -= 0.3f;
 		}
+		RequestFullRateAnim(DeathDuration);
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Player Died! Playing 'Death' Section. Duration: %.2f"), DeathDuration);
+	UE_LOG(LogBattle, Log, TEXT("Player Died! Playing 'Death' Section. Duration: %.2f"), DeathDuration);
 
 	// 4. 애니메이션 길이만큼 기다린 후 FinishDying 호출 (타이머)
 	FTimerHandle DeathTimer;
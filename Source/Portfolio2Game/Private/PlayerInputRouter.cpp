@@ -0,0 +1,31 @@
+﻿#include "PlayerInputRouter.h"
+
+void FPlayerInputRouter::Buffer(EPlayerCommand Command, double Now, const FInputLatencyStamp& InputStamp)
+{
+	BufferedCommand = Command;
+	BufferedTime = Now;
+	BufferedStamp = InputStamp;
+}
+
+EPlayerCommand FPlayerInputRouter::ConsumeBuffered(double Now, float Window, FInputLatencyStamp& OutInputStamp)
+{
+	const EPlayerCommand Command = BufferedCommand;
+	BufferedCommand = EPlayerCommand::None;
+	OutInputStamp = BufferedStamp;
+	OutInputStamp.bBuffered = true;
+
+	if (Command == EPlayerCommand::None || Now - BufferedTime > Window)
+	{
+		return EPlayerCommand::None;
+	}
+	return Command;
+}
+
+void FPlayerInputRouter::Reset()
+{
+	bOpen = false;
+	UnlockTime = 0.0;
+	BufferedCommand = EPlayerCommand::None;
+	BufferedTime = 0.0;
+	BufferedStamp = FInputLatencyStamp();
+}
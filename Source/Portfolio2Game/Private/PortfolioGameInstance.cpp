@@ -1,10 +1,25 @@
 ﻿#include "PortfolioGameInstance.h"
+#include "Portfolio2Game.h"
 #include "Kismet/GameplayStatics.h"
+#include "CharacterBase.h"
+#include "GridMotionSubsystem.h"
+#include "BattleHUDViewModel.h"
+#include "BattleUILayerSubsystem.h"
+#include "BattleMemoryReport.h"
+#include "EngineUtils.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
 
 void UPortfolioGameInstance::Init()
 {
 	Super::Init();
 
+	{
+		BATTLE_LLM_SCOPE(UI);
+		HUDViewModel = NewObject<UBattleHUDViewModel>(this);
+	}
+	PushStageToHUD();
+
 	TickDelegateHandle = FTSTicker::GetCoreTicker().AddTicker(
 		FTickerDelegate::CreateUObject(this, &UPortfolioGameInstance::TickPlayTime)
 	);
@@ -20,9 +35,23 @@ bool UPortfolioGameInstance::TickPlayTime(float DeltaTime)
 
 	TotalPlayTime += DeltaTime;
 
+	// 초 단위가 바뀔 때만 HUD에 알림
+	if (HUDViewModel)
+	{
+		HUDViewModel->SetPlayTime(TotalPlayTime);
+	}
+
 	return true;
 }
 
+void UPortfolioGameInstance::PushStageToHUD()
+{
+	if (HUDViewModel)
+	{
+		HUDViewModel->SetStageDisplayName(StageList.IsValidIndex(CurrentStageIndex) ? StageList[CurrentStageIndex] : NAME_None);
+	}
+}
+
 FString UPortfolioGameInstance::GetCurrentStageDisplayName()
 {
 	// 현재 인덱스를 기반으로 이름 반환
@@ -68,11 +97,78 @@ FName UPortfolioGameInstance::GetNextStageName()
 
 	// 3. 해당 이름 반환
 	FName NextMapName = StageList[CurrentStageIndex];
+	PushStageToHUD();
 	UE_LOG(LogTemp, Warning, TEXT("[GameInstance] Moving to Stage Index: %d (%s)"), CurrentStageIndex, *NextMapName.ToString());
 
 	return NextMapName;
 }
 
+FName UPortfolioGameInstance::PeekNextStageName() const
+{
+	if (StageList.IsEmpty()) return NAME_None;
+
+	const int32 NextIndex = (CurrentStageIndex + 1 >= StageList.Num()) ? 0 : CurrentStageIndex + 1;
+	return StageList[NextIndex];
+}
+
+void UPortfolioGameInstance::PreloadStageMap(FName MapName)
+{
+	if (MapName.IsNone() || MapName == PreloadedMapName) return;
+
+	// PIE는 맵을 복제해서 열기 때문에 미리 읽은 패키지가 재사용되지 않음
+	UWorld* World = GetWorld();
+	if (World && World->IsPlayInEditor()) return;
+
+	// StageList는 짧은 맵 이름(AA)이므로 실제 패키지 경로로 변환
+	FString LongPackageName = MapName.ToString();
+	if (!FPackageName::IsValidLongPackageName(LongPackageName)
+		&& !FPackageName::SearchForPackageOnDisk(MapName.ToString(), &LongPackageName))
+	{
+		UE_LOG(LogBattle, Warning, TEXT("[GameInstance] Preload skipped: map package not found (%s)"), *MapName.ToString());
+		return;
+	}
+
+	PreloadedMapName = MapName;
+	PreloadedMapPackage = nullptr;
+
+	const double StartTime = FPlatformTime::Seconds();
+	TWeakObjectPtr<UPortfolioGameInstance> WeakThis(this);
+	LoadPackageAsync(LongPackageName, FLoadPackageAsyncDelegate::CreateLambda(
+		[WeakThis, MapName, StartTime](const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+		{
+			UPortfolioGameInstance* GI = WeakThis.Get();
+			if (!GI || GI->PreloadedMapName != MapName) return;
+
+			if (Result == EAsyncLoadingResult::Succeeded && Package)
+			{
+				GI->PreloadedMapPackage = Package;
+				UE_LOG(LogBattle, Log, TEXT("[GameInstance] Preloaded %s in %.1f ms"),
+					*PackageName.ToString(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+			}
+			else
+			{
+				GI->PreloadedMapName = NAME_None;
+				UE_LOG(LogBattle, Warning, TEXT("[GameInstance] Preload failed: %s"), *PackageName.ToString());
+			}
+		}));
+}
+
+void UPortfolioGameInstance::LoadComplete(const float LoadTime, const FString& MapName)
+{
+	Super::LoadComplete(LoadTime, MapName);
+
+	UE_LOG(LogBattle, Log, TEXT("[GameInstance] Map %s loaded in %.2f s (Preloaded: %s)"),
+		*MapName, LoadTime, PreloadedMapPackage ? TEXT("Yes") : TEXT("No"));
+
+	// 새 월드가 패키지를 참조하므로 보관 해제
+	PreloadedMapPackage = nullptr;
+	PreloadedMapName = NAME_None;
+
+	// 스테이지 전환마다 메모리 예산 리포트 (첫 스테이지 대비 증가량)
+	FBattleMemoryReport::OnStageTransition(GetWorld(),
+		StageList.IsValidIndex(CurrentStageIndex) ? StageList[CurrentStageIndex] : FName(*MapName), DifficultyLevel);
+}
+
 void UPortfolioGameInstance::ResetGameData()
 {
 	// 1. 저장 데이터 초기화
@@ -88,10 +184,68 @@ void UPortfolioGameInstance::ResetGameData()
 	// 3. 통계 초기화
 	TotalPlayTime = 0.0f;
 	TotalKillCount = 0;
+	FBattleMemoryReport::ResetBaseline();
+
+	// 4. 이전 런의 공용 UI 레이어(상단 바/덮개) 정리
+	if (UBattleUILayerSubsystem* UILayer = GetSubsystem<UBattleUILayerSubsystem>())
+	{
+		UILayer->ResetAllLayers();
+	}
+
+	if (HUDViewModel)
+	{
+		HUDViewModel->SetPlayTime(TotalPlayTime);
+	}
+	PushStageToHUD();
 
 	UE_LOG(LogTemp, Warning, TEXT("[GameInstance] Game Data Reset! Ready for New Game."));
 }
 
+void UPortfolioGameInstance::SetInstantResolve(bool bEnable)
+{
+	bInstantResolve = bEnable;
+
+	if (UWorld* World = GetWorld())
+	{
+		for (TActorIterator<ACharacterBase> It(World); It; ++It)
+		{
+			It->CustomTimeDilation = GetVisualTimeDilation();
+		}
+	}
+
+	UE_LOG(LogBattle, Log, TEXT("[GameInstance] Instant Resolve: %s"), bInstantResolve ? TEXT("ON") : TEXT("OFF"));
+}
+
+void UPortfolioGameInstance::SkipPendingVisuals()
+{
+	UWorld* World = GetWorld();
+	if (!bInstantResolve || !World) return;
+
+	// 1. 이동 먼저 확정 (도착 처리에서 재생되는 정지 몽타주도 아래에서 함께 건너뜀)
+	if (UGridMotionSubsystem* Motion = World->GetSubsystem<UGridMotionSubsystem>())
+	{
+		Motion->FinishAllMoves();
+	}
+
+	// 2. 몽타주
+	for (TActorIterator<ACharacterBase> It(World); It; ++It)
+	{
+		It->SkipMontagesToEnd();
+	}
+}
+
+bool UPortfolioGameInstance::IsInstantResolve(const UObject* WorldContextObject)
+{
+	const UPortfolioGameInstance* GI = Cast<UPortfolioGameInstance>(UGameplayStatics::GetGameInstance(WorldContextObject));
+	return GI && GI->bInstantResolve;
+}
+
+float UPortfolioGameInstance::GetTurnStepDelay(const UObject* WorldContextObject, float NormalDelay)
+{
+	// 타이머는 0초면 등록되지 않으므로 최소값 = 다음 프레임 실행
+	return IsInstantResolve(WorldContextObject) ? KINDA_SMALL_NUMBER : NormalDelay;
+}
+
 TArray<USkillBase*> UPortfolioGameInstance::LoadAllSkillsFromPath(FName Path)
 {
 	TArray<USkillBase*> LoadedSkills;
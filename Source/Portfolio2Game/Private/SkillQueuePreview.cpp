@@ -0,0 +1,98 @@
+﻿#include "SkillQueuePreview.h"
+#include "PlayerCharacter.h"
+#include "EnemyCharacter.h"
+#include "BattleManager.h"
+#include "BaseAttributeSet.h"
+#include "PlayerSkillDataLibrary.h"
+
+FSkillQueuePreview FSkillQueuePreview::Build(const APlayerCharacter* Player)
+{
+	FSkillQueuePreview Out;
+	if (!Player || !Player->BattleManagerRef || Player->SkillQueueIndices.Num() == 0) return Out;
+
+	const ABattleManager* BM = Player->BattleManagerRef;
+	const FGridGeometry& Grid = BM->GetGridGeometry();
+	if (!Grid.IsValid()) return Out;
+
+	// 1. 보드 복사 (적 위치 + HP만)
+	struct FSimUnit
+	{
+		AEnemyCharacter* Enemy;
+		float HPBefore;
+		float HP;
+		int32 KilledBySlot;
+	};
+
+	TArray<FSimUnit, TInlineAllocator<16>> Units;
+	TArray<int32, TInlineAllocator<64>> CellToUnit;
+	CellToUnit.Init(INDEX_NONE, Grid.Num());
+
+	for (AEnemyCharacter* Enemy : BM->Enemies)
+	{
+		if (!Enemy || !Enemy->Attributes || !Grid.IsValidCoord(Enemy->GridCoord)) continue;
+
+		const float HP = Enemy->Attributes->GetHP();
+		CellToUnit[Grid.CoordToIndex(Enemy->GridCoord)] = Units.Add({ Enemy, HP, HP, INDEX_NONE });
+	}
+
+	// 2. 큐 순서대로 판정
+	const FIntPoint Origin = Player->GridCoord;
+	const EGridDirection Facing = Player->FacingDirection;
+	TBitArray<> CellHit(false, Grid.Num());
+
+	for (int32 Slot = 0; Slot < Player->SkillQueueIndices.Num(); ++Slot)
+	{
+		const int32 SkillIndex = Player->SkillQueueIndices[Slot];
+		if (!Player->OwnedSkills.IsValidIndex(SkillIndex)) continue;
+
+		const FPlayerSkillData& SkillData = Player->OwnedSkills[SkillIndex];
+		if (!SkillData.SkillInfo) continue;
+
+		const float Damage = (float)UPlayerSkillDataLibrary::GetEffectiveDamage(SkillData);
+
+		for (const FIntPoint& Point : SkillData.SkillInfo->AttackPattern)
+		{
+			const FIntPoint Target = Origin + ACharacterBase::RotatePatternOffset(Point, Facing);
+			if (Target == Origin || !Grid.IsValidCoord(Target)) continue;
+
+			const int32 Cell = Grid.CoordToIndex(Target);
+			if (!CellHit[Cell])
+			{
+				CellHit[Cell] = true;
+				Out.AffectedCells.Add(Target);
+			}
+
+			const int32 UnitIndex = CellToUnit[Cell];
+			if (UnitIndex == INDEX_NONE) continue;
+
+			FSimUnit& Unit = Units[UnitIndex];
+			if (Unit.KilledBySlot != INDEX_NONE) continue; // 이미 처치됨 (GetCharacterAt에서 제외되는 것과 동일)
+
+			Unit.HP = FMath::Max(0.0f, Unit.HP - Damage);
+			if (Unit.HP <= 0.0f)
+			{
+				Unit.KilledBySlot = Slot;
+			}
+		}
+	}
+
+	// 3. 결과 정리 (피해 받은 적만)
+	for (const FSimUnit& Unit : Units)
+	{
+		if (Unit.HP >= Unit.HPBefore) continue;
+
+		FSkillPreviewTarget& Target = Out.Targets.AddDefaulted_GetRef();
+		Target.Enemy = Unit.Enemy;
+		Target.Coord = Unit.Enemy->GridCoord;
+		Target.HPBefore = FMath::RoundToInt(Unit.HPBefore);
+		Target.HPAfter = FMath::RoundToInt(Unit.HP);
+		Target.Damage = Target.HPBefore - Target.HPAfter;
+		Target.bKilled = Unit.KilledBySlot != INDEX_NONE;
+		Target.KilledBySlot = Unit.KilledBySlot;
+
+		Out.TotalDamage += Target.Damage;
+		Out.PredictedKills += Target.bKilled ? 1 : 0;
+	}
+
+	return Out;
+}
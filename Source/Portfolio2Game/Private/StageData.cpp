@@ -2,4 +2,300 @@
 
 
 #include "StageData.h"
+#include "Portfolio2Game.h"
+#include "BattleMemoryReport.h"
+#include "UObject/ObjectSaveContext.h"
 
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
+
+#define LOCTEXT_NAMESPACE "StageData"
+
+namespace StageDataPrivate
+{
+	// FStageRuntimePlan::PlanVersion 현재 값
+	// 1: 적 클래스 소프트 참조 (이전 하드 참조 플랜은 버전 0으로 저장되어 있음)
+	constexpr int32 CurrentPlanVersion = 1;
+
+	// AdvanceTriggers를 비워둔 라운드의 기존 진행 규칙
+	static void AddDefaultAdvanceTriggers(TArray<FRoundTrigger>& Out)
+	{
+		FRoundTrigger AllKilled;
+		AllKilled.Type = ERoundTriggerType::AllKilled;
+		Out.Add(AllKilled);
+
+		FRoundTrigger SingleEnemy;
+		SingleEnemy.Type = ERoundTriggerType::SingleEnemyTimer;
+		SingleEnemy.Value = 2;
+		Out.Add(SingleEnemy);
+	}
+
+	static int32 AddGroup(FStageRuntimePlan& Plan, const TArray<TSoftClassPtr<AEnemyCharacter>>& Enemies, ESpawnCellRule Rule, const TArray<int32>& Cells)
+	{
+		FCompiledSpawnGroup& Group = Plan.Groups.AddDefaulted_GetRef();
+
+		// 비어 있는 항목은 미리 걸러냄 (경로만 보므로 로드하지 않음)
+		Group.Classes.Reserve(Enemies.Num());
+		for (const TSoftClassPtr<AEnemyCharacter>& EnemyClass : Enemies)
+		{
+			if (!EnemyClass.IsNull()) Group.Classes.Add(EnemyClass);
+		}
+		Group.Rule = Rule;
+		if (Rule != ESpawnCellRule::RandomDefault)
+		{
+			Group.Cells = Cells;
+		}
+
+		Plan.TotalEnemies += Group.Classes.Num();
+		return Plan.Groups.Num() - 1;
+	}
+
+#if WITH_EDITOR
+	// 경로 문자열로 해시 (하드 참조 시절과 같은 값이 나오므로 플랜 구조 변경은 PlanVersion으로 감지)
+	static uint32 HashClass(const TSoftClassPtr<AEnemyCharacter>& EnemyClass)
+	{
+		return EnemyClass.IsNull() ? FCrc::StrCrc32(TEXT("None")) : FCrc::StrCrc32(*EnemyClass.ToSoftObjectPath().ToString());
+	}
+#endif
+}
+
+#if WITH_EDITOR
+uint32 UStageData::ComputeSourceHash() const
+{
+	using namespace StageDataPrivate;
+
+	uint32 Hash = GetTypeHash(Rounds.Num());
+	for (const FRoundDef& Round : Rounds)
+	{
+		for (const TSoftClassPtr<AEnemyCharacter>& EnemyClass : Round.EnemiesToSpawn)
+		{
+			Hash = HashCombine(Hash, HashClass(EnemyClass));
+		}
+		Hash = HashCombine(Hash, GetTypeHash((uint8)Round.SpawnRule));
+		for (int32 Cell : Round.SpawnCells) Hash = HashCombine(Hash, GetTypeHash(Cell));
+		for (const FRoundTrigger& Trigger : Round.AdvanceTriggers)
+		{
+			Hash = HashCombine(Hash, GetTypeHash((uint8)Trigger.Type));
+			Hash = HashCombine(Hash, GetTypeHash(Trigger.Value));
+		}
+		for (const FReinforcementWave& Wave : Round.Reinforcements)
+		{
+			Hash = HashCombine(Hash, GetTypeHash((uint8)Wave.Trigger.Type));
+			Hash = HashCombine(Hash, GetTypeHash(Wave.Trigger.Value));
+			Hash = HashCombine(Hash, GetTypeHash((uint8)Wave.SpawnRule));
+			for (const TSoftClassPtr<AEnemyCharacter>& EnemyClass : Wave.EnemiesToSpawn)
+			{
+				Hash = HashCombine(Hash, HashClass(EnemyClass));
+			}
+			for (int32 Cell : Wave.SpawnCells) Hash = HashCombine(Hash, GetTypeHash(Cell));
+		}
+	}
+	return Hash;
+}
+#endif
+
+void UStageData::CompilePlan()
+{
+	using namespace StageDataPrivate;
+	BATTLE_LLM_SCOPE(StageData);
+
+	FStageRuntimePlan Plan;
+	Plan.Rounds.Reserve(Rounds.Num());
+
+	for (const FRoundDef& Round : Rounds)
+	{
+		FCompiledRound& Compiled = Plan.Rounds.AddDefaulted_GetRef();
+		Compiled.GroupIndex = AddGroup(Plan, Round.EnemiesToSpawn, Round.SpawnRule, Round.SpawnCells);
+
+		if (Round.AdvanceTriggers.Num() > 0)
+		{
+			Compiled.AdvanceTriggers = Round.AdvanceTriggers;
+		}
+		else
+		{
+			AddDefaultAdvanceTriggers(Compiled.AdvanceTriggers);
+		}
+
+		for (const FReinforcementWave& Wave : Round.Reinforcements)
+		{
+			FCompiledWave& CompiledWave = Compiled.Waves.AddDefaulted_GetRef();
+			CompiledWave.Trigger = Wave.Trigger;
+			CompiledWave.GroupIndex = AddGroup(Plan, Wave.EnemiesToSpawn, Wave.SpawnRule, Wave.SpawnCells);
+		}
+	}
+
+#if WITH_EDITOR
+	// 해시는 에디터(저장/쿡)에서만 계산. 쿡된 에셋은 원본이 바뀔 수 없으므로 런타임에는 비교하지 않음
+	Plan.SourceHash = ComputeSourceHash();
+#endif
+	Plan.PlanVersion = StageDataPrivate::CurrentPlanVersion;
+	CompiledPlan = MoveTemp(Plan);
+}
+
+void UStageData::GetRequiredEnemyClasses(TArray<FSoftObjectPath>& OutPaths) const
+{
+	for (const FCompiledSpawnGroup& Group : CompiledPlan.Groups)
+	{
+		for (const TSoftClassPtr<AEnemyCharacter>& EnemyClass : Group.Classes)
+		{
+			OutPaths.AddUnique(EnemyClass.ToSoftObjectPath());
+		}
+	}
+}
+
+void UStageData::PostLoad()
+{
+	Super::PostLoad();
+
+	// 예전 에셋(플랜 없음 / 이전 버전 플랜)은 로드 시 다시 만듦 (런타임은 저장된 값만 비교, 해시 재계산 없음)
+	const bool bStalePlan = (Rounds.Num() > 0 && CompiledPlan.IsEmpty()) || CompiledPlan.PlanVersion != StageDataPrivate::CurrentPlanVersion;
+
+#if WITH_EDITOR
+	// 에디터에서는 저장 이후 원본이 바뀐 경우(다른 경로로 수정된 에셋 등)도 감지
+	if (bStalePlan || CompiledPlan.SourceHash != ComputeSourceHash())
+	{
+		CompilePlan();
+	}
+#else
+	if (bStalePlan)
+	{
+		UE_LOG(LogBattle, Warning, TEXT("StageData %s: 쿡된 플랜이 없거나 버전이 달라 로드 시 다시 컴파일합니다 (에셋 재저장 필요)"), *GetName());
+		CompilePlan();
+	}
+#endif
+}
+
+void UStageData::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	// 저장/쿡 시점에 컴파일해서 런타임에는 변환 비용이 없도록 함
+	CompilePlan();
+}
+
+#if WITH_EDITOR
+void UStageData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	CompilePlan();
+}
+
+EDataValidationResult UStageData::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = Super::IsDataValid(Context);
+
+	if (Rounds.Num() == 0)
+	{
+		Context.AddError(LOCTEXT("NoRounds", "라운드가 하나도 없습니다."));
+		Result = EDataValidationResult::Invalid;
+	}
+
+	const int32 CellLimit = GridCellCount;
+
+	auto ValidateGroup = [&Context, &Result, CellLimit](const FText& Where, const TArray<TSoftClassPtr<AEnemyCharacter>>& Enemies, ESpawnCellRule Rule, const TArray<int32>& Cells)
+	{
+		for (int32 i = 0; i < Enemies.Num(); ++i)
+		{
+			if (Enemies[i].IsNull())
+			{
+				Context.AddError(FText::Format(LOCTEXT("NullEnemy", "{0}: {1}번째 적 클래스가 비어 있습니다."), Where, FText::AsNumber(i)));
+				Result = EDataValidationResult::Invalid;
+			}
+		}
+
+		for (int32 Cell : Cells)
+		{
+			if (Cell < 0)
+			{
+				Context.AddError(FText::Format(LOCTEXT("BadCell", "{0}: 스폰 칸 인덱스({1})가 음수입니다."), Where, FText::AsNumber(Cell)));
+				Result = EDataValidationResult::Invalid;
+			}
+			else if (CellLimit > 0 && Cell >= CellLimit)
+			{
+				Context.AddError(FText::Format(LOCTEXT("UnknownCell", "{0}: 스폰 칸 인덱스({1})가 그리드 범위(0~{2}) 밖입니다."),
+					Where, FText::AsNumber(Cell), FText::AsNumber(CellLimit - 1)));
+				Result = EDataValidationResult::Invalid;
+			}
+		}
+
+		// 같은 칸이 두 번 나오면 두 번째 적은 항상 대체 칸으로 밀려남
+		TSet<int32> SeenCells;
+		for (int32 Cell : Cells)
+		{
+			bool bAlreadySeen = false;
+			SeenCells.Add(Cell, &bAlreadySeen);
+			if (bAlreadySeen)
+			{
+				Context.AddWarning(FText::Format(LOCTEXT("DupCell", "{0}: 스폰 칸 {1}이(가) 중복되어 있습니다."), Where, FText::AsNumber(Cell)));
+			}
+		}
+
+		if (Rule == ESpawnCellRule::Fixed && Cells.Num() < Enemies.Num())
+		{
+			Context.AddError(FText::Format(LOCTEXT("FixedCells", "{0}: Fixed 배치인데 스폰 칸({1})이 적 수({2})보다 적습니다."),
+				Where, FText::AsNumber(Cells.Num()), FText::AsNumber(Enemies.Num())));
+			Result = EDataValidationResult::Invalid;
+		}
+		else if (Rule == ESpawnCellRule::RandomFromList && Cells.Num() == 0)
+		{
+			Context.AddError(FText::Format(LOCTEXT("NoCells", "{0}: RandomFromList 배치인데 스폰 칸이 비어 있습니다."), Where));
+			Result = EDataValidationResult::Invalid;
+		}
+	};
+
+	// RoundEnemyCount: 이번 라운드에 나올 수 있는 최대 적 수 (라운드 + 모든 증원)
+	auto ValidateTrigger = [&Context, &Result](const FText& Where, const FRoundTrigger& Trigger, int32 RoundEnemyCount)
+	{
+		if (Trigger.Type != ERoundTriggerType::AllKilled && Trigger.Value <= 0)
+		{
+			Context.AddError(FText::Format(LOCTEXT("BadTrigger", "{0}: 조건 기준값은 1 이상이어야 합니다."), Where));
+			Result = EDataValidationResult::Invalid;
+		}
+		else if (Trigger.Type == ERoundTriggerType::KillCount && Trigger.Value > RoundEnemyCount)
+		{
+			Context.AddError(FText::Format(LOCTEXT("KillCountUnreachable", "{0}: 처치 수 조건({1})이 이번 라운드 최대 적 수({2})보다 커서 발동할 수 없습니다."),
+				Where, FText::AsNumber(Trigger.Value), FText::AsNumber(RoundEnemyCount)));
+			Result = EDataValidationResult::Invalid;
+		}
+	};
+
+	for (int32 r = 0; r < Rounds.Num(); ++r)
+	{
+		const FRoundDef& Round = Rounds[r];
+		const FText RoundText = FText::Format(LOCTEXT("RoundLabel", "{0}라운드"), FText::AsNumber(r + 1));
+
+		int32 RoundEnemyCount = Round.EnemiesToSpawn.Num();
+		for (const FReinforcementWave& Wave : Round.Reinforcements)
+		{
+			RoundEnemyCount += Wave.EnemiesToSpawn.Num();
+		}
+
+		ValidateGroup(RoundText, Round.EnemiesToSpawn, Round.SpawnRule, Round.SpawnCells);
+
+		// 마지막 라운드의 진행 조건은 판정되지 않음 (전멸 + 증원 소진 시 클리어)
+		if (r == Rounds.Num() - 1 && Round.AdvanceTriggers.Num() > 0)
+		{
+			Context.AddWarning(FText::Format(LOCTEXT("LastRoundAdvance", "{0}: 마지막 라운드의 진행 조건은 사용되지 않습니다."), RoundText));
+		}
+
+		for (const FRoundTrigger& Trigger : Round.AdvanceTriggers)
+		{
+			ValidateTrigger(RoundText, Trigger, RoundEnemyCount);
+		}
+
+		for (int32 w = 0; w < Round.Reinforcements.Num(); ++w)
+		{
+			const FReinforcementWave& Wave = Round.Reinforcements[w];
+			const FText WaveText = FText::Format(LOCTEXT("WaveLabel", "{0} 증원 {1}"), RoundText, FText::AsNumber(w + 1));
+
+			ValidateGroup(WaveText, Wave.EnemiesToSpawn, Wave.SpawnRule, Wave.SpawnCells);
+			ValidateTrigger(WaveText, Wave.Trigger, RoundEnemyCount);
+		}
+	}
+
+	return Result;
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
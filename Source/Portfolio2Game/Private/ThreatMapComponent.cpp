@@ -0,0 +1,192 @@
+﻿#include "ThreatMapComponent.h"
+#include "Portfolio2Game.h"
+#include "BattleManager.h"
+#include "EnemyCharacter.h"
+#include "GridISM.h"
+#include "SkillBase.h"
+
+UThreatMapComponent::UThreatMapComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+ABattleManager* UThreatMapComponent::GetBattleManager() const
+{
+	return Cast<ABattleManager>(GetOwner());
+}
+
+bool UThreatMapComponent::EnsureCellBuffers()
+{
+	ABattleManager* BM = GetBattleManager();
+	if (!BM || !BM->GetGridGeometry().IsValid()) return false;
+
+	const int32 CellCount = BM->GetGridGeometry().Num();
+	if (CellDamage.Num() != CellCount)
+	{
+		ResetThreats();
+		CellDamage.SetNumZeroed(CellCount);
+		CellAttackers.SetNum(CellCount);
+	}
+	return true;
+}
+
+void UThreatMapComponent::ResetThreats()
+{
+	// 기존 오버레이 끄기
+	if (ABattleManager* BM = GetBattleManager())
+	{
+		if (AGridISM* Grid = Cast<AGridISM>(BM->GridActorRef))
+		{
+			if (bDriveTileOverlay) Grid->ClearTileState(EGridTileState::Threat);
+		}
+	}
+
+	for (float& Damage : CellDamage) Damage = 0.0f;
+	for (auto& Attackers : CellAttackers) Attackers.Reset();
+	EnemyThreats.Reset();
+
+	OnThreatMapChanged.Broadcast();
+}
+
+void UThreatMapComponent::UpdateEnemy(AEnemyCharacter* Enemy)
+{
+	if (!Enemy || !EnsureCellBuffers()) return;
+
+	TArray<int32, TInlineAllocator<32>> TouchedCells;
+
+	// 1. 이전 기여분 빼기
+	if (const FEnemyThreat* Old = EnemyThreats.Find(Enemy))
+	{
+		TouchedCells.Append(Old->Cells);
+		RemoveContribution(Enemy, *Old);
+		EnemyThreats.Remove(Enemy);
+	}
+
+	// 2. 다음 적 턴에 발사할 예약 스킬이 있으면 다시 더하기
+	USkillBase* Skill = Enemy->ReservedSkill;
+	const bool bWillFire = Skill && !Enemy->bDead && Enemy->IsOnBoard() && Enemy->PendingAction == EAIActionType::FireReserved;
+
+	if (bWillFire)
+	{
+		const FGridGeometry& Grid = GetBattleManager()->GetGridGeometry();
+
+		FEnemyThreat NewThreat;
+		NewThreat.Damage = (float)Skill->BaseDamage;
+
+		for (const FIntPoint& Point : Skill->AttackPattern)
+		{
+			const FIntPoint Target = Enemy->GridCoord + ACharacterBase::RotatePatternOffset(Point, Enemy->FacingDirection);
+			if (Target == Enemy->GridCoord || !Grid.IsValidCoord(Target)) continue;
+
+			const int32 Index = Grid.CoordToIndex(Target);
+			if (NewThreat.Cells.Contains(Index)) continue;
+
+			NewThreat.Cells.Add(Index);
+			CellDamage[Index] += NewThreat.Damage;
+			CellAttackers[Index].Add(Enemy);
+			TouchedCells.AddUnique(Index);
+		}
+
+		if (NewThreat.Cells.Num() > 0)
+		{
+			EnemyThreats.Add(Enemy, MoveTemp(NewThreat));
+		}
+	}
+
+	if (TouchedCells.Num() == 0) return;
+
+	UE_LOG_BATTLE_UNIT(Enemy, VeryVerbose, TEXT("Threat updated: %s (%d cells)"), *Enemy->GetName(), TouchedCells.Num());
+
+	PushTileOverlay(TouchedCells);
+	OnThreatMapChanged.Broadcast();
+}
+
+void UThreatMapComponent::RemoveContribution(AEnemyCharacter* Enemy, const FEnemyThreat& Threat)
+{
+	for (int32 Index : Threat.Cells)
+	{
+		if (!CellAttackers.IsValidIndex(Index)) continue;
+
+		CellAttackers[Index].RemoveSingle(Enemy);
+
+		// 공격자가 없으면 부동소수 오차 없이 0으로
+		CellDamage[Index] = CellAttackers[Index].Num() > 0 ? FMath::Max(0.0f, CellDamage[Index] - Threat.Damage) : 0.0f;
+	}
+}
+
+void UThreatMapComponent::PushTileOverlay(const TArray<int32, TInlineAllocator<32>>& TouchedCells)
+{
+	if (!bDriveTileOverlay) return;
+
+	ABattleManager* BM = GetBattleManager();
+	AGridISM* Grid = BM ? Cast<AGridISM>(BM->GridActorRef) : nullptr;
+	if (!Grid) return;
+
+	// 바뀐 칸만 켜기/끄기 두 묶음으로 나눠 한 번씩 갱신
+	// SetTileStates가 TArray를 받으므로 멤버 버퍼를 재사용 (용량 유지, 턴 중 재할당 없음)
+	TArray<int32>& OnCells = ScratchOnCells;
+	TArray<int32>& OffCells = ScratchOffCells;
+	OnCells.Reset();
+	OffCells.Reset();
+	for (int32 Index : TouchedCells)
+	{
+		(CellAttackers[Index].Num() > 0 ? OnCells : OffCells).Add(Index);
+	}
+
+	if (OnCells.Num() > 0) Grid->SetTileStates(OnCells, EGridTileState::Threat, true);
+	if (OffCells.Num() > 0) Grid->SetTileStates(OffCells, EGridTileState::Threat, false);
+}
+
+// ───────── 조회 ─────────
+
+float UThreatMapComponent::GetThreatDamageAt(FIntPoint Coord) const
+{
+	const ABattleManager* BM = GetBattleManager();
+	if (!BM || !BM->GetGridGeometry().IsValidCoord(Coord)) return 0.0f;
+
+	const int32 Index = BM->GetGridGeometry().CoordToIndex(Coord);
+	return CellDamage.IsValidIndex(Index) ? CellDamage[Index] : 0.0f;
+}
+
+bool UThreatMapComponent::IsCellThreatened(FIntPoint Coord) const
+{
+	const ABattleManager* BM = GetBattleManager();
+	if (!BM || !BM->GetGridGeometry().IsValidCoord(Coord)) return false;
+
+	const int32 Index = BM->GetGridGeometry().CoordToIndex(Coord);
+	return CellAttackers.IsValidIndex(Index) && CellAttackers[Index].Num() > 0;
+}
+
+TArray<AEnemyCharacter*> UThreatMapComponent::GetAttackersAt(FIntPoint Coord) const
+{
+	TArray<AEnemyCharacter*> Result;
+
+	const ABattleManager* BM = GetBattleManager();
+	if (!BM || !BM->GetGridGeometry().IsValidCoord(Coord)) return Result;
+
+	const int32 Index = BM->GetGridGeometry().CoordToIndex(Coord);
+	if (!CellAttackers.IsValidIndex(Index)) return Result;
+
+	for (const TWeakObjectPtr<AEnemyCharacter>& Attacker : CellAttackers[Index])
+	{
+		if (Attacker.IsValid()) Result.Add(Attacker.Get());
+	}
+	return Result;
+}
+
+TArray<FIntPoint> UThreatMapComponent::GetThreatenedCells() const
+{
+	TArray<FIntPoint> Result;
+
+	const ABattleManager* BM = GetBattleManager();
+	if (!BM) return Result;
+
+	for (int32 Index = 0; Index < CellAttackers.Num(); ++Index)
+	{
+		if (CellAttackers[Index].Num() > 0)
+		{
+			Result.Add(BM->GetGridGeometry().IndexToCoord(Index));
+		}
+	}
+	return Result;
+}
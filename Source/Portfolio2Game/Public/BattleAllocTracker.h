@@ -0,0 +1,48 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+class UCombatEventBusSubsystem;
+
+/**
+ * 턴 단위 힙 할당 카운터 (Shipping 제외)
+ * - 게임 스레드에서 일어난 GMalloc 할당 횟수/바이트를 턴마다 집계 (목표: 턴 루프 0회)
+ * - 실행 인자 -BattleAllocTrack : 모듈 시작 시 카운팅 프록시를 GMalloc 앞에 설치하고 집계 시작
+ *   (실행 중에는 GMalloc을 바꾸지 않음. 프록시는 엔진의 Malloc 프록시처럼 프로세스 종료까지 유지)
+ * - Battle.Alloc.Track 0/1 : 집계만 끄고 켬 (프록시가 설치된 경우에만 동작)
+ * - Battle.Alloc.Dump : 최근 턴별 할당 기록 출력
+ * - 턴 경계는 전투 이벤트 버스의 TurnStart로 받음 (BindCombatEvents), 전투 종료 시 BattleManager가 EndTurn
+ */
+#if UE_BUILD_SHIPPING
+class FBattleAllocTracker
+{
+public:
+	static void InstallAtStartup() {}
+	static bool IsTracking() { return false; }
+	static void BeginTurn(int32 Turn, bool bPlayerTurn) {}
+	static void EndTurn() {}
+	static void Dump(FOutputDevice& Ar) {}
+	static void BindCombatEvents(UCombatEventBusSubsystem& Bus) {}
+};
+#else
+class PORTFOLIO2GAME_API FBattleAllocTracker
+{
+public:
+	// 모듈 시작 시 호출. -BattleAllocTrack이 있으면 프록시 설치 + 집계 시작
+	static void InstallAtStartup();
+
+	static bool IsTracking();
+	static void SetTracking(bool bEnable);
+
+	// 이전 턴 집계를 닫고 새 턴 집계 시작
+	static void BeginTurn(int32 Turn, bool bPlayerTurn);
+
+	// 현재 턴 집계를 닫음 (전투 종료 등)
+	static void EndTurn();
+
+	// 월드의 전투 이벤트 버스에서 TurnStart마다 BeginTurn
+	static void BindCombatEvents(UCombatEventBusSubsystem& Bus);
+
+	static void Dump(FOutputDevice& Ar);
+};
+#endif
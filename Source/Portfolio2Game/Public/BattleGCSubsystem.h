@@ -0,0 +1,85 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BattleGCSubsystem.generated.h"
+
+// [신규] 전투 GC 통계 (GameInstance가 보관해 OpenLevel을 넘어 게임 전체로 누적)
+struct FBattleGCStats
+{
+	// 정책 ON/OFF별 GC 정지 통계
+	struct FGCPauseStats
+	{
+		int32 NumPauses = 0;
+		int32 NumInAction = 0;	// 행동 재생 중에 걸린 정지
+		double TotalMs = 0.0;
+		double InActionMs = 0.0;
+		double MaxMs = 0.0;
+	};
+	FGCPauseStats PauseStats[2];
+
+	int32 NumDeferredFrames = 0;	// 행동 중이라 GC를 미룬 프레임
+	int32 NumIdleCollects = 0;		// 한가한 구간에 당겨서 요청한 GC
+	int32 NumPurgeSlices = 0;		// 한가한 구간에 직접 돌린 증분 Purge
+	double PurgeSliceMs = 0.0;
+	int32 NumWorlds = 0;			// 통계에 참여한 전투 월드(스테이지) 수
+
+	void Reset() { *this = FBattleGCStats(); }
+};
+
+/**
+ * [신규] 전투 상황에 맞춘 GC 스케줄러 (월드 서브시스템)
+ * - 행동 재생 중(이동/회전/스킬 몽타주, EndAction 후 여운 포함)에는 주기 GC를 미룸
+ * - 한가한 구간(플레이어 입력 대기, 적 계획, 전환 화면)에는 남은 증분 Purge를 예산 안에서 진행하고,
+ *   마지막 GC 후 일정 시간이 지났으면 미리 GC를 당겨서 실행 (행동 중에 주기 GC가 걸리지 않게)
+ * - 너무 오래 미뤄졌으면(Battle.GC.MaxDeferSec) 더 이상 막지 않음
+ * - 모든 GC 정지를 정책 ON/OFF별로 기록해 "행동 중에 걸린 GC" 수를 비교 (Battle.GC.Dump)
+ * - 통계는 GameInstance의 FBattleGCStats에 쌓아 스테이지 이동(OpenLevel) 후에도 유지
+ */
+UCLASS()
+class PORTFOLIO2GAME_API UBattleGCSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// 행동 재생 시작 (적: StartAction / 플레이어: 명령 실행 시점)
+	static void BeginActionPlayback(const AActor* Actor);
+
+	// 행동 재생 종료 (HoldSeconds 동안은 남은 몽타주를 위해 계속 재생 중으로 간주)
+	static void EndActionPlayback(const AActor* Actor, float HoldSeconds);
+
+	bool IsActionPlaying() const;
+
+	void DumpStats(FOutputDevice& Ar) const;
+	void ResetStats();
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+private:
+	// 행동 중인 유닛 -> 재생 중으로 볼 마감 시각 (FPlatformTime 기준)
+	TMap<TWeakObjectPtr<const AActor>, double> ActivePlayback;
+
+	// GameInstance가 없을 때(에디터 프리뷰 월드 등)만 쓰는 대체 통계
+	FBattleGCStats LocalStats;
+
+	// 누적 대상 (PortfolioGameInstance가 있으면 그쪽, 없으면 LocalStats)
+	FBattleGCStats& GetStats();
+	const FBattleGCStats& GetStats() const;
+
+	double LastGCEndTime = 0.0;
+	double GCStartTime = 0.0;
+	bool bGCStartedInAction = false;
+	bool bGCStartedWithPolicy = false;
+	bool bIdleCollectRequested = false;
+
+	FDelegateHandle PreGCHandle;
+	FDelegateHandle PostGCHandle;
+
+	void HandlePreGC();
+	void HandlePostGC();
+};
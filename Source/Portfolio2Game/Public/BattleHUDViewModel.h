@@ -0,0 +1,113 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "BattleHUDViewModel.generated.h"
+
+struct FPlayerSkillData;
+struct FCombatEvent;
+class UCombatEventBusSubsystem;
+
+// 변경 알림 단위 (위젯은 자기가 그리는 필드만 골라서 갱신)
+UENUM(BlueprintType)
+enum class EBattleHUDField : uint8
+{
+	Turn,
+	Round,
+	EnemyCount,		// AliveEnemies / RemainingEnemies
+	PlayerHealth,	// PlayerHP / PlayerMaxHP
+	Cooldowns,
+	SkillQueue,
+	PlayTime,
+	StageName,
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBattleHUDFieldChanged, EBattleHUDField, Field);
+
+// 스킬 슬롯 하나의 쿨타임이 바뀔 때 (슬롯 위젯용)
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBattleHUDCooldownChanged, int32, SkillIndex, int32, Cooldown);
+
+/**
+ * [신규] 전투 HUD 뷰모델 (GameInstance 소유, 레벨 이동 후에도 유지)
+ * - 게임 쪽이 변경 시점에만 Set 함수로 값을 밀어넣고, 값이 실제로 달라졌을 때만 필드 단위로 방송
+ * - 위젯은 생성 시 현재 값을 한 번 읽고 OnFieldChanged 구독 (프로퍼티 바인딩/매 프레임 Getter 호출 없음)
+ * - 플레이 시간은 초 단위가 바뀔 때만 갱신
+ * - 턴/라운드/플레이어 체력은 전투 이벤트 버스에서 직접 받음 (BindCombatEvents)
+ */
+UCLASS(BlueprintType)
+class PORTFOLIO2GAME_API UBattleHUDViewModel : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	// GameInstance에서 뷰모델 조회 (없으면 nullptr)
+	UFUNCTION(BlueprintPure, Category = "UI|HUD", meta = (WorldContext = "WorldContextObject"))
+	static UBattleHUDViewModel* Get(const UObject* WorldContextObject);
+
+	// ───────── 변경 알림 ─────────
+
+	UPROPERTY(BlueprintAssignable, Category = "UI|HUD")
+	FOnBattleHUDFieldChanged OnFieldChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "UI|HUD")
+	FOnBattleHUDCooldownChanged OnCooldownChanged;
+
+	// ───────── 값 (읽기 전용, 변경은 Set 함수로만) ─────────
+
+	UPROPERTY(BlueprintReadOnly, Category = "UI|HUD")
+	int32 Turn = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UI|HUD")
+	int32 Round = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UI|HUD")
+	int32 AliveEnemies = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UI|HUD")
+	int32 RemainingEnemies = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UI|HUD")
+	int32 PlayerHP = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UI|HUD")
+	int32 PlayerMaxHP = 0;
+
+	// OwnedSkills 인덱스 순서
+	UPROPERTY(BlueprintReadOnly, Category = "UI|HUD")
+	TArray<int32> Cooldowns;
+
+	// 큐에 들어간 스킬 인덱스 (실행 순서)
+	UPROPERTY(BlueprintReadOnly, Category = "UI|HUD")
+	TArray<int32> SkillQueue;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UI|HUD")
+	int32 PlayTimeSeconds = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UI|HUD")
+	FText StageDisplayName;
+
+	// ───────── 갱신 (게임 코드 전용) ─────────
+
+	void SetTurn(int32 InTurn);
+	void SetRound(int32 InRound);
+	void SetEnemyCounts(int32 InAlive, int32 InRemaining);
+	void SetPlayerHealth(int32 InHP, int32 InMaxHP);
+	void SetSkillCooldowns(const TArray<FPlayerSkillData>& Skills);
+	void SetSkillQueue(const TArray<int32>& QueueIndices);
+	void SetPlayTime(float TotalSeconds);
+	void SetStageDisplayName(FName StageName);
+
+	// 월드의 전투 이벤트 버스 구독 (TurnStart / RoundStart / 플레이어 HealthChanged). 같은 버스면 무시
+	void BindCombatEvents(UCombatEventBusSubsystem& Bus);
+
+private:
+	void HandleCombatEvent(const FCombatEvent& Event);
+
+	// 월드가 바뀌면 버스도 새로 생기므로 마지막으로 구독한 버스만 기억
+	TWeakObjectPtr<UCombatEventBusSubsystem> BoundBus;
+
+	void NotifyField(EBattleHUDField Field) { OnFieldChanged.Broadcast(Field); }
+
+	// 이름 → 텍스트 변환은 스테이지가 바뀔 때만
+	FName CachedStageName;
+};
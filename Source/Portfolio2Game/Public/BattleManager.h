@@ -6,12 +6,31 @@
 #include "EnemyOrderManager.h"
 #include "Camera/CameraActor.h"
 #include "StageData.h"
+#include "GridGeometry.h"
 #include "BattleManager.generated.h"
 
+struct FStreamableHandle;
+
 // 전방 선언
+class UThreatMapComponent;
 class APlayerCharacter;
 class AEnemyCharacter;
 class ACharacterBase;
+class UNiagaraComponent;
+class AEnforceManager;
+
+// [신규] 적 풀: 클래스별 대기 중인 적 목록
+USTRUCT()
+struct FEnemyPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AEnemyCharacter>> Inactive;
+};
+
+// [신규] 생존 적 수 변경 알림 (UI는 폴링 대신 구독)
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAliveEnemyCountChanged, int32, AliveCount, int32, RemainingInStage);
 
 UENUM(BlueprintType)
 enum class EBattleState : uint8
@@ -68,9 +87,7 @@ public:
 
 	int32 TurnsSinceSingleEnemy = 0;
 
-	UUserWidget* CurrentTransitionWidget; // 임시 저장용
-
-	// [신규] 이번 스테이지의 총 적 숫자 (BeginBattle에서 자동 계산됨)
+	// [신규] 이번 스테이지의 총 적 숫자 (BeginBattle에서 플랜 값으로 시작, 못 나오게 된 적은 DropExpectedEnemies로 차감)
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Battle|State")
 	int32 TotalEnemiesInStage = 0;
 
@@ -83,10 +100,19 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Battle|Rules")
 	int32 MaxKillCount = 4;
 
+	// 캐릭터 행동 사이 대기 시간 (즉시 판정 모드에서는 무시하고 다음 프레임 진행)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Battle|Rules")
+	float TurnStepDelay = 0.2f;
+
 	// 클리어 후 이동할 다음 레벨 이름 (예: Stage_Enforce)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Battle|Rules")
 	FName NextLevelName;
 
+	// [신규] 다음 단계가 오버레이 강화 단계(GameInstance::OverlayEnforceStages)일 때 이 레벨에 띄울 강화 매니저
+	// (카드 풀/HUD가 설정된 BP_EnforceManager, 비우면 기존처럼 강화 맵으로 이동)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Battle|Rules")
+	TSubclassOf<AEnforceManager> EnforceOverlayClass;
+
 	// 이동 직전에 보여줄 연출 위젯 (검은 화면 페이드 등)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Battle|UI")
 	TSubclassOf<UUserWidget> TransitionWidgetClass;
@@ -99,6 +125,21 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Battle|State")
 	int32 TotalSpawnedCount = 0;
 
+	// [신규] 현재 보드 위 생존 적 수 (스폰/사망 시 갱신, 배열 재순회 없음)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Battle|State")
+	int32 AliveEnemyCount = 0;
+
+	// [신규] 생존 적 수 / 남은 적 수가 바뀔 때마다 방송 (GetRemainingEnemyCount 폴링 대체)
+	UPROPERTY(BlueprintAssignable, Category = "Battle|Events")
+	FOnAliveEnemyCountChanged OnAliveEnemyCountChanged;
+
+	// [신규] 현재 라운드 진입 후 처치 수 / 경과 턴 수 (라운드 트리거 판정용)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Battle|State")
+	int32 RoundKillCount = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Battle|State")
+	int32 RoundTurnCount = 0;
+
 	// 적이 죽었을 때 호출 (Kill Count 증가)
 	void OnEnemyKilled(AEnemyCharacter* DeadEnemy);
 
@@ -134,6 +175,11 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Actors")
 	TObjectPtr<APlayerCharacter> PlayerRef; // 에디터에서 None이 정상
 
+	// [신규] 적 예약 스킬 위협 맵 (적별 변경 시에만 증분 갱신)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<UThreatMapComponent> ThreatMap;
+
+	// 보드 위 생존 적 (스폰 시 추가, 사망 즉시 제거, 스폰 순서 유지 = 행동 순서)
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Actors")
 	TArray<TObjectPtr<AEnemyCharacter>> Enemies;
 
@@ -168,15 +214,19 @@ public:
 	void OnPlayerDeathFinished();
 
 	// ───────── 스테이지 설정 (에디터 할당) ─────────
-	// 이 맵에서 나올 수 있는 스테이지 후보들
+	// 이 맵에서 나올 수 있는 스테이지 후보들 (소프트 참조: 선택된 하나만 로드, 나머지는 로드하지 않음)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stage Setup")
-	TArray<UStageData*> PossibleStages;
+	TArray<TSoftObjectPtr<UStageData>> PossibleStages;
 
 	// ───────── 런타임 상태 ─────────
-	// 현재 결정된 스테이지 (PossibleStages 중 하나가 랜덤 선택됨)
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stage Status")
+	// 현재 결정된 스테이지 (PossibleStages 중 하나가 랜덤 선택되어 비동기 로드됨)
+	UPROPERTY(VisibleAnywhere, Transient, BlueprintReadOnly, Category = "Stage Status")
 	UStageData* CurrentStageData;
 
+	// 스테이지 + 적 클래스 로드 완료 여부
+	UFUNCTION(BlueprintPure, Category = "Stage Status")
+	bool IsStageReady() const { return bStageReady; }
+
 	// 현재 라운드 인덱스 (0부터 시작)
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stage Status")
 	int32 CurrentRoundIndex = 0;
@@ -191,6 +241,27 @@ protected:
 	void MoveToNextLevel();
 
 	void ExecuteUncover();
+
+	// [신규] 클리어 후 강화 단계를 이 레벨에서 오버레이로 시작 (시작했으면 true, 다음 전투 맵은 그동안 미리 로드)
+	bool TryStartEnforceOverlay();
+
+	UPROPERTY(Transient)
+	TObjectPtr<AEnforceManager> EnforceOverlay;
+
+	// ───────── 스테이지 비동기 로드 ─────────
+	// BeginPlay에서 후보 하나를 고르고 전환 화면이 덮고 있는 동안 로드
+	// 1단계: UStageData 에셋 / 2단계: 그 스테이지가 쓰는 적 클래스
+	// 로드가 끝나기 전 BeginBattle / 전환 화면 해제 요청은 보류했다가 완료 시 실행
+	void RequestStageLoad();
+	void OnStageDataLoaded();
+	void OnStageAssetsLoaded();
+
+	TSharedPtr<FStreamableHandle> StageLoadHandle;
+	TSoftObjectPtr<UStageData> SelectedStage;
+
+	bool bStageReady = false;
+	bool bBeginBattlePending = false;
+	bool bUncoverPending = false;
 	// ──────────────────────────────
 	// 스폰 관련
 	// ──────────────────────────────
@@ -213,6 +284,76 @@ protected:
 	// 다음 라운드 시작 (적이 다 죽거나 2턴 지났을 때 호출)
 	void StartNextRound();
 
+	// ───────── 적 풀링 ─────────
+	// 클래스별 대기 중인 적 (사망한 적은 파괴하지 않고 여기로 반납)
+	UPROPERTY(Transient)
+	TMap<TSubclassOf<AEnemyCharacter>, FEnemyPoolBucket> EnemyPool;
+
+	// 대기 중인 적을 숨겨둘 위치 (그리드 아래)
+	UPROPERTY(EditAnywhere, Category = "Spawn|Pool")
+	FVector PoolParkingLocation = FVector(0.0f, 0.0f, -10000.0f);
+
+	// 스테이지 데이터 기준으로 필요한 만큼 미리 스폰 (스테이지 선택 직후, 시작 연출 중에 호출)
+	void PrewarmEnemyPool();
+
+	// 풀에서 꺼내 지정 칸에 배치 (없으면 새로 스폰)
+	AEnemyCharacter* AcquireEnemy(TSubclassOf<AEnemyCharacter> EnemyClassToSpawn, FIntPoint Coord, int32 Index);
+
+	// 실제 스폰 (풀 예열이면 대기 상태로 생성)
+	AEnemyCharacter* SpawnEnemyActor(TSubclassOf<AEnemyCharacter> EnemyClassToSpawn, FIntPoint Coord, int32 Index, bool bForPool);
+
+public:
+	// 사망 연출이 끝난 적을 풀로 반납 (AEnemyCharacter::FinishDying에서 호출)
+	void ReleaseEnemy(AEnemyCharacter* Enemy);
+
+protected:
+	// ───────── 스테이지 타임라인 ─────────
+	// 현재 라운드에서 이미 발동한 증원 (FCompiledRound::Waves 인덱스 기준)
+	TBitArray<> FiredWaves;
+
+	// 컴파일된 스테이지 계획에서 현재 라운드 (없으면 nullptr)
+	const FCompiledRound* GetCurrentCompiledRound() const;
+
+	bool HasNextRound() const;
+
+	// 다음 라운드 또는 미발동 증원이 남아 있는가? (스테이지 클리어 판정용)
+	bool HasPendingSpawns() const;
+
+	// bEnemyTurnEnd: 적 턴 종료 시점(true) / 플레이어 턴 시작 시점(false)
+	bool IsRoundTriggerMet(const FRoundTrigger& Trigger, bool bEnemyTurnEnd) const;
+
+	// 턴 경계에서 증원/라운드 진행 트리거를 카운터 기준으로 평가
+	void EvaluateStageTimeline(bool bEnemyTurnEnd);
+
+	// 스폰 그룹 하나를 보드에 배치 (라운드 본대 / 증원 공용)
+	// 칸 선택은 즉시, 실제 스폰은 작업 분할기로 프레임 예산 안에서 순서대로
+	void SpawnGroup(int32 GroupIndex);
+
+	// [신규] 칸은 예약했지만 아직 스폰되지 않은 적 (작업 분할기 대기 중)
+	TArray<int32> PendingSpawnCells;
+
+	// 트리거/클리어 판정용 적 수 (스폰 대기 포함 = 분할 없이 스폰했을 때와 같은 값)
+	int32 GetBoardEnemyCount() const { return AliveEnemyCount + PendingSpawnCells.Num(); }
+
+	// [신규] 프레임 예산 작업 분할 (서브시스템이 없으면 즉시 실행)
+	void RunSliced(FName Label, int32 NumItems, TFunction<void(int32)> ItemFn, TFunction<void()> OnComplete);
+
+	// 플레이어 턴 시작 후반부: 적 행동 계획(분할) -> 행동 큐 UI -> 플레이어 입력 허용
+	void PlanEnemyTurnSliced();
+	void FinishPlayerTurnStart();
+
+	// ───────── 생존 적 목록 ─────────
+	// Enemies / AliveEnemyCount를 함께 갱신하고 OnAliveEnemyCountChanged 방송
+	void AddAliveEnemy(AEnemyCharacter* Enemy);
+	void RemoveAliveEnemy(AEnemyCharacter* Enemy);
+	void BroadcastAliveEnemyCount();
+
+	// 예정됐지만 나오지 않게 된 적(배치 실패/스폰 실패/버려진 증원)을 총합에서 제외 (남은 적 수가 클리어 시 0이 되도록)
+	void DropExpectedEnemies(int32 Count, const TCHAR* Reason);
+
+	// [신규] 전투 시작 시 HUD 뷰모델의 턴/라운드 초기화 (이후 변화는 이벤트 버스 TurnStart/RoundStart로 전달)
+	void PushTurnStateToHUD();
+
 	// ──────────────────────────────
 	// 유틸리티
 	// ──────────────────────────────
@@ -221,6 +362,13 @@ public:
 	UPROPERTY(Transient, BlueprintReadOnly, Category = "Grid")
 	TScriptInterface<IGridDataInterface> GridInterface;
 
+	// [신규] 그리드 형태 캐시 (좌표 변환은 전부 여기서, 인터페이스 호출 없음)
+	const FGridGeometry& GetGridGeometry() const { return GridGeometry; }
+
+	// [신규] 그리드 설정(크기/오프셋/위치)을 바꾼 뒤 BP에서 호출하면 캐시 재생성
+	UFUNCTION(BlueprintCallable, Category = "Grid")
+	void RefreshGridGeometry();
+
 	FVector GridToWorld(FIntPoint GridPos) const;
 
 	/** (오류 수정) GA_Move가 접근할 수 있도록 public으로 이동 */
@@ -245,9 +393,36 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UI")
 	TSubclassOf<UUserWidget> TopBarWidgetClass;
 
+#if !UE_BUILD_SHIPPING
+	// [신규] 현재 보드 상태(그리드 배치, 유닛, 예약 행동)를 문자열로 정리 (단계 모니터 덤프용)
+	FString DescribeBoardState() const;
+#endif
+
+	// [신규] 수명이 있는 스킬 이펙트 등록 (이펙트마다 타이머를 만들지 않고 하나의 타이머로 일괄 만료)
+	void RegisterTimedEffect(UNiagaraComponent* Effect, float LifeTime);
+
 protected:
+	// ───────── 시간제 이펙트 ─────────
+	struct FTimedEffect
+	{
+		TWeakObjectPtr<UNiagaraComponent> Component;
+		double ExpireTime = 0.0;
+	};
+
+	// 용량은 유지 (전투 중 최대치까지만 자라고 이후 재할당 없음)
+	TArray<FTimedEffect> TimedEffects;
+	FTimerHandle TimedEffectHandle;
+
+	void ExpireTimedEffects();
+
+
 	void CheckSingleEnemyTimer();
 	void CheckBattleResult();
 
+	// 그리드 액터가 이동하면 월드 좌표 테이블 재생성
+	void OnGridTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	FGridGeometry GridGeometry;
+
 	FTimerHandle TurnDelayHandle;
 };
\ No newline at end of file
@@ -0,0 +1,60 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+// ───────── LLM 태그 ─────────
+// Battle/Grid, Battle/Enemies ... 로 LLM 리포트(stat LLM / -llmcsv)에 표시됨 (-llm 으로 실행 시)
+LLM_DECLARE_TAG_API(Battle, PORTFOLIO2GAME_API);
+LLM_DECLARE_TAG_API(Battle_Grid, PORTFOLIO2GAME_API);		// 그리드 타일 + HP바 풀
+LLM_DECLARE_TAG_API(Battle_Enemies, PORTFOLIO2GAME_API);	// 적 액터 (메시, ASC, 위젯 컴포넌트)
+LLM_DECLARE_TAG_API(Battle_SkillFX, PORTFOLIO2GAME_API);	// 스킬 이펙트 (나이아가라)
+LLM_DECLARE_TAG_API(Battle_StageData, PORTFOLIO2GAME_API);	// 스테이지 데이터 / 컴파일된 스폰 계획
+LLM_DECLARE_TAG_API(Battle_UI, PORTFOLIO2GAME_API);			// 공용 UI 레이어, HUD, 메뉴 위젯
+
+// 이 스코프 안의 할당을 Battle/<Tag>로 집계
+#define BATTLE_LLM_SCOPE(Tag) LLM_SCOPE_BYTAG(Battle_##Tag)
+
+// 리포트에서 다루는 태그 (LLM 태그와 1:1)
+enum class EBattleMemTag : uint8
+{
+	Grid,
+	Enemies,
+	SkillFX,
+	StageData,
+	UI,
+
+	Count
+};
+
+/**
+ * 스테이지 전환마다 메모리 예산 리포트 (Shipping 제외)
+ * - 맵 로드 완료 시 스냅샷: LLM 태그별 사용량, 물리 메모리, 주요 오브젝트 수, 이전 월드에 남은 액터/월드 수
+ * - 런 첫 스테이지 대비 증가량 / 직전 스테이지 대비 증가량 / 태그별 예산 초과 표시
+ * - Battle.Memory.ReportOnTransition 1 : 스테이지 전환마다 자동 출력 (기본 켜짐)
+ * - Battle.Memory.Report [-timers] : 지금 스냅샷을 찍고 출력 (-timers: 등록된 타이머 목록도 출력)
+ * - Battle.Memory.ResetBaseline : 기록 초기화 (다음 스냅샷이 새 기준)
+ */
+#if UE_BUILD_SHIPPING
+class FBattleMemoryReport
+{
+public:
+	static void OnStageTransition(UWorld* World, FName StageName, int32 Difficulty) {}
+	static void ResetBaseline() {}
+};
+#else
+class PORTFOLIO2GAME_API FBattleMemoryReport
+{
+public:
+	// 맵 로드 완료 시 GameInstance가 호출 (스냅샷 기록 + 설정에 따라 출력)
+	static void OnStageTransition(UWorld* World, FName StageName, int32 Difficulty);
+
+	// 스냅샷을 찍고 첫 스테이지/직전 스테이지와 비교 출력
+	static void Report(UWorld* World, FOutputDevice& Ar, bool bListTimers);
+
+	// 새 런 시작 (ResetGameData 등)
+	static void ResetBaseline();
+
+	static const TCHAR* GetTagName(EBattleMemTag Tag);
+};
+#endif
@@ -0,0 +1,93 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+class ABattleManager;
+
+// 게임 스레드 비용을 측정할 전투 단계
+enum class EBattlePhase : uint8
+{
+	PlayerInput,		// 플레이어 입력 처리 (이동/회전/스킬 선택·실행)
+	EnemyPlanning,		// 플레이어 턴 시작 시 전체 적의 행동 결정
+	EnemyAction,		// 적 1명의 행동 실행
+	SkillResolution,	// 스킬 판정 (이펙트 스폰 + 데미지)
+	RoundSpawn,			// 라운드 전환 및 적 소환
+	LevelTransition,	// 스테이지 시작/클리어/레벨 이동
+
+	Count
+};
+
+// 단계 1회 측정 기록
+// 단계 범위가 중첩되면(예: PlayerInput 안의 SkillResolution) Ms는 안쪽 단계를 뺀 자기 시간,
+// InclusiveMs는 안쪽 단계를 포함한 전체 시간. 통계/예산 판정은 Ms 기준이라 중복 집계되지 않음
+struct FBattlePhaseSample
+{
+	EBattlePhase Phase = EBattlePhase::PlayerInput;
+	double Ms = 0.0;
+	double InclusiveMs = 0.0;
+	uint64 Frame = 0;
+	FName Context; // 유닛 이름 등
+};
+
+// 예산 초과 기록 (트레이스 + 보드 상태 스냅샷)
+struct FBattlePhaseViolation
+{
+	FBattlePhaseSample Sample;
+	double BudgetMs = 0.0;
+	int32 Turn = 0;
+	int32 Round = 0;
+	FDateTime Time;
+
+	// 초과 직전까지의 최근 단계 기록 (오래된 순)
+	TArray<FBattlePhaseSample> RecentTrace;
+
+	// 그리드/유닛/예약 행동 상태
+	FString BoardState;
+};
+
+/**
+ * 전투 단계별 프레임 비용 모니터 (Shipping 제외, BATTLE_PHASE_SCOPE도 빈 매크로)
+ * - Battle.PhaseMonitor.Enable (기본 꺼짐) / Battle.PhaseMonitor.BudgetMs 로 제어
+ * - Battle.PhaseMonitor.Dump : 단계별 통계 + 예산 초과 기록 출력
+ * - Battle.PhaseMonitor.ExportCSV [경로] : 예산 초과 기록 CSV 저장 (기본 Saved/Profiling)
+ * - Battle.PhaseMonitor.Reset : 기록 초기화
+ */
+#if UE_BUILD_SHIPPING
+#define BATTLE_PHASE_SCOPE(Phase, Manager, Context)
+#else
+class PORTFOLIO2GAME_API FBattlePhaseMonitor
+{
+public:
+	static bool IsEnabled();
+	static double GetBudgetMs();
+
+	// 단계 1회 측정 결과 보고 (SelfMs 기준으로 집계, 예산 초과 시 Manager에서 보드 상태를 가져와 기록)
+	static void Report(EBattlePhase Phase, double SelfMs, double InclusiveMs, const ABattleManager* Manager, const UObject* Context);
+
+	static const TArray<FBattlePhaseViolation>& GetViolations();
+	static void Dump(FOutputDevice& Ar);
+	static bool ExportCSV(const FString& FilePath);
+	static void Reset();
+
+	static const TCHAR* GetPhaseName(EBattlePhase Phase);
+};
+
+// 생성 ~ 소멸 구간을 하나의 단계로 측정 (안쪽에 열린 단계 시간은 바깥 단계에서 제외)
+class PORTFOLIO2GAME_API FScopedBattlePhase
+{
+public:
+	FScopedBattlePhase(EBattlePhase InPhase, const ABattleManager* InManager, const UObject* InContext = nullptr);
+	~FScopedBattlePhase();
+
+private:
+	EBattlePhase Phase;
+	const ABattleManager* Manager;
+	const UObject* Context;
+	uint64 StartCycles;
+	uint64 ChildCycles = 0;				// 안쪽 단계들이 쓴 시간
+	FScopedBattlePhase* Parent = nullptr;	// 바깥 단계 (게임 스레드 전용 스택)
+};
+
+#define BATTLE_PHASE_SCOPE(Phase, Manager, Context) \
+	FScopedBattlePhase PREPROCESSOR_JOIN(BattlePhaseScope_, __LINE__)(Phase, Manager, Context)
+#endif
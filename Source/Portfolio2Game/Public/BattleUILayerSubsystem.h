@@ -0,0 +1,97 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "BattleUILayerSubsystem.generated.h"
+
+class UUserWidget;
+class SWidget;
+
+// 레벨 이동 후에도 유지되는 공용 UI 레이어
+UENUM(BlueprintType)
+enum class EBattleUILayer : uint8
+{
+	TopBar,
+	Transition,		// 모래바람 덮기/걷기
+	BattleStart,
+	Count UMETA(Hidden)
+};
+
+/**
+ * [신규] 공용 UI 레이어 (GameInstance 서브시스템)
+ * - 상단 바 / 전환 연출 / 전투 시작 위젯을 게임 내내 한 번만 만들고 Slate 트리까지 유지
+ * - 레벨 이동(OpenLevel) 때 엔진이 뷰포트에서 떼어내면, 새 월드 로드 직후 같은 인스턴스를 다시 붙임
+ *   (위젯 재생성 / Construct / Slate 트리 재구성 없음)
+ * - 다시 붙이는 건 GameInstance의 StageList에 있는 맵(전투/강화)으로 갈 때만,
+ *   메인 화면 등 흐름 밖의 맵으로 가면 레이어를 모두 버림 (그 맵에는 덮개를 걷을 매니저가 없음)
+ * - 덮기(PlayCover)와 걷기(PlayUncover)가 같은 전환 위젯 인스턴스에서 이어서 재생됨
+ * - 다시 붙인 뒤 위젯 BP에 OnUILayerRebound 함수가 있으면 호출 (새 월드 액터 참조 갱신용)
+ * - 위젯 클래스는 지금처럼 각 매니저가 에디터 설정값을 넘김 (처음 요청한 클래스로 생성)
+ */
+UCLASS()
+class PORTFOLIO2GAME_API UBattleUILayerSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UBattleUILayerSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// 레이어 표시 (없으면 생성, 있으면 재사용). bOutCreated: 이번에 새로 만들었는지 (= Construct 실행됨)
+	UUserWidget* ShowLayer(EBattleUILayer Layer, TSubclassOf<UUserWidget> WidgetClass, bool* bOutCreated = nullptr);
+
+	// 뷰포트에서만 떼어냄 (인스턴스와 Slate 트리는 유지)
+	UFUNCTION(BlueprintCallable, Category = "UI")
+	void HideLayer(EBattleUILayer Layer);
+
+	// 인스턴스까지 버림 (다음 ShowLayer에서 새로 생성되어 Construct부터 다시 실행)
+	void ResetLayer(EBattleUILayer Layer);
+
+	// 모든 레이어를 버림 (새 게임 시작 / 전투 흐름 밖의 맵으로 이동)
+	UFUNCTION(BlueprintCallable, Category = "UI")
+	void ResetAllLayers();
+
+	UFUNCTION(BlueprintPure, Category = "UI")
+	UUserWidget* GetLayerWidget(EBattleUILayer Layer) const;
+
+	// ───────── 전환 연출 ─────────
+
+	// 화면 덮기 시작 (위젯 BP의 PlayCover 호출)
+	void PlayCover(TSubclassOf<UUserWidget> TransitionClass);
+
+	// 덮인 상태 보장 (이전 레벨에서 덮고 넘어왔으면 그대로, 아니면 덮인 모습의 새 위젯)
+	void EnsureCovered(TSubclassOf<UUserWidget> TransitionClass);
+
+	// 화면 걷기 (위젯 BP의 PlayUncover 호출 후 HideDelay초 뒤 뷰포트에서 떼어냄)
+	void PlayUncover(float HideDelay = 2.0f);
+
+	UFUNCTION(BlueprintPure, Category = "UI")
+	bool IsCovered() const { return bCovered; }
+
+private:
+	// 레이어별 위젯 인스턴스 (EBattleUILayer 인덱스)
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UUserWidget>> LayerWidgets;
+
+	// 뷰포트에서 떨어져 있는 동안 Slate 트리가 파괴되지 않도록 붙잡아 둠
+	TSharedPtr<SWidget> SlateRoots[(int32)EBattleUILayer::Count];
+
+	// 맵 로드 직전에 뷰포트에 붙어 있었는지 (로드 후 다시 붙일 대상)
+	bool bRestoreAfterLoad[(int32)EBattleUILayer::Count] = {};
+
+	bool bCovered = false;
+
+	FTimerHandle UncoverHideHandle;
+
+	static int32 GetZOrder(EBattleUILayer Layer);
+
+	void AttachToViewport(EBattleUILayer Layer);
+
+	void HandlePreLoadMap(const FString& MapName);
+	void HandlePostLoadMap(UWorld* LoadedWorld);
+
+	// 전투 흐름(StageList)에 속한 맵인지
+	bool IsStageFlowMap(const UWorld* World) const;
+};
@@ -0,0 +1,61 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BattleWorkSlicerSubsystem.generated.h"
+
+/**
+ * [신규] 프레임 예산 기반 작업 분할기 (월드 서브시스템)
+ * - 턴 시작 AI 계획 / 라운드 시작 스폰처럼 한 프레임에 몰리는 작업을 항목 단위로 나눠 여러 프레임에 실행
+ * - 배치는 등록 순서(FIFO)대로, 배치 안의 항목도 순서대로 실행, 배치가 끝나면 완료 콜백 호출 후 다음 배치 시작
+ * - 등록 즉시 이번 프레임 예산만큼 바로 실행하므로 작은 배치는 지금처럼 같은 프레임에 끝남
+ * - Battle.WorkSlicer.BudgetMs : 프레임당 예산 (최소 1항목은 항상 실행)
+ * - Battle.WorkSlicer.Enable 0 : 예산 무시하고 전부 즉시 실행 (기존 동작)
+ */
+UCLASS()
+class PORTFOLIO2GAME_API UBattleWorkSlicerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// NumItems개 항목을 순서대로 ItemFn(Index) 실행, 전부 끝나면 OnComplete
+	void Enqueue(FName Label, int32 NumItems, TFunction<void(int32)> ItemFn, TFunction<void()> OnComplete = nullptr);
+
+	// 앞선 배치가 모두 끝난 뒤 실행 (비어 있으면 즉시)
+	void RunWhenIdle(FName Label, TFunction<void()> Fn) { Enqueue(Label, 0, nullptr, MoveTemp(Fn)); }
+
+	bool IsBusy() const { return Batches.Num() > 0; }
+
+	// 남은 작업을 예산 무시하고 전부 실행 (전투 종료/레벨 이동 직전 등)
+	void Flush();
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	virtual void Deinitialize() override;
+
+private:
+	struct FWorkBatch
+	{
+		FName Label;
+		int32 NumItems = 0;
+		int32 NextItem = 0;
+		int32 StartFrame = 0;
+		TFunction<void(int32)> ItemFn;
+		TFunction<void()> OnComplete;
+	};
+
+	// 앞에서부터 실행 (배치 수는 한 자릿수라 배열 앞 삭제로 충분)
+	TArray<FWorkBatch> Batches;
+
+	// 이번 프레임에 이미 쓴 예산 (등록 즉시 실행 + Tick 합산)
+	uint64 BudgetFrame = 0;
+	double UsedMsThisFrame = 0.0;
+
+	bool bPumping = false;
+
+	// 예산 안에서 실행 (bIgnoreBudget이면 전부)
+	void Pump(bool bIgnoreBudget);
+};
@@ -35,7 +35,8 @@ class PORTFOLIO2GAME_API ACharacterBase : public ACharacter, public IAbilitySyst
 	GENERATED_BODY()
 
 public:
-	ACharacterBase();
+	// CharacterMovementComponent는 만들지 않음 (이동/회전은 전부 스크립트로 처리)
+	ACharacterBase(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	// BP에서 설정 가능한 Z오프셋 (기본값 100)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawn")
@@ -68,7 +69,7 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "UI")
 	TObjectPtr<AActor> HPBarActor;
 
-	// HP 변경 델리게이트 인스턴스
+	// HP 변경 델리게이트 인스턴스 (BP 전용. 네이티브는 HandleHealthChanged 오버라이드 / 이벤트 버스 HealthChanged)
 	UPROPERTY(BlueprintAssignable, Category = "Attributes")
 	FOnHealthChangedSignature OnHealthChanged;
 
@@ -76,8 +77,8 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid")
 	int32 CachedGridIndex = -1;
 
-	UFUNCTION()
-	void OnHealthChanged_Wrapper(int32 CurrentHP, int32 MaxHP);
+	// 체력 변경 네이티브 처리 (HP바 / 플레이어 사망). NotifyHealthChanged가 직접 호출
+	virtual void HandleHealthChanged(int32 CurrentHP, int32 MaxHP);
 
 	// GAS의 체력 변경 감지용 함수 선언
 	virtual void OnHealthAttributeChanged(const FOnAttributeChangeData& Data);
@@ -119,6 +120,23 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Turn")
 	virtual void EndAction();
 
+	// ───────── 애니메이션 예산 ─────────
+	// [신규] 지정 시간 동안 메시를 매 프레임 평가 (HoldSeconds <= 0 이면 무시: 몽타주/섹션 길이 0 = 재생할 것 없음)
+	// 그 외에는 Battle.Anim.IdleTickInterval 간격으로만 평가 (행동 중인 유닛만 풀 레이트)
+	void RequestFullRateAnim(float HoldSeconds);
+
+	// 다음 EndAction까지 풀 레이트 유지 (StartAction 전용)
+	void HoldFullRateAnim();
+
+protected:
+	void ApplyIdleAnimBudget();
+
+	// StartAction ~ EndAction 구간 (이 동안은 시간 만료로 내려가지 않음)
+	bool bAnimFullRateHeld = false;
+	FTimerHandle AnimBudgetTimerHandle;
+
+public:
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Ref")
 	TObjectPtr<ABattleManager> BattleManagerRef;
 
@@ -158,35 +176,39 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Move")
 	void PlayMoveAnim();
 
-	// 매 프레임 이동 처리를 위해 Tick 오버라이드
-	virtual void Tick(float DeltaTime) override;
+	// [신규] 이동 연출 도착 처리 (UGridMotionSubsystem이 위치를 확정한 뒤 호출)
+	void FinishVisualMove();
+
+	// 즉시 판정 모드에서 시작한 연출 전용 몽타주로 표시 (SkipMontagesToEnd 대상)
+	void MarkMontageSkippable(UAnimMontage* Montage);
+
+	// 표시된 몽타주만 섹션 연결을 따라 끝(또는 대기 루프 섹션)으로 건너뜀
+	// 노티파이를 건너뛰므로 로직이 노티파이를 기다리는 일반 모드 몽타주(스킬 Hit 등)는 건드리지 않음
+	void SkipMontagesToEnd();
 
 	// [신규] UI나 컨트롤러가 바인딩할 이벤트
 	UPROPERTY(BlueprintAssignable, Category = "Events")
 	FOnCharacterBusyChanged OnBusyStateChanged;
 
 protected:
-	// 이동 시작 지점 (보간용)
-	FVector VisualMoveStartLocation;
-
-	// 이동 경과 시간
-	float VisualMoveTimeElapsed = 0.0f;
-
 	// 이동 총 소요 시간
 	float VisualMoveDuration = 0.3f;
 
-	// 이동 중인지 체크하는 플래그
+	// 이동 중인지 체크하는 플래그 (보간 자체는 UGridMotionSubsystem이 진행)
 	bool bIsVisualMoving = false;
 
-	// 이동할 목표 월드 좌표
-	FVector VisualMoveDestination;
-
 	// 이동 시작 함수
 	void StartVisualMove(const FVector& TargetLocation);
 
+	// MarkMontageSkippable로 표시한 몽타주 인스턴스 ID (끝난 것은 SkipMontagesToEnd에서 정리)
+	TArray<int32, TInlineAllocator<4>> SkippableMontageInstances;
+
 	// 정지 애니메이션 대기용 타이머
 	FTimerHandle StopAnimTimerHandle;
 
+	// 즉시 판정 모드로 도착 전에 턴을 넘긴 이동인지 (도착 시 EndAction 중복 방지)
+	bool bMoveResolvedEarly = false;
+
 	// 정지 애니메이션이 끝나면 호출될 함수
 	void OnStopAnimEnded();
 
@@ -254,6 +276,12 @@ public:
 	// [신규] 유틸리티: 방향 Enum -> 월드 회전값(Rotator) 변환
 	FRotator GetRotationFromEnum(EGridDirection Dir) const;
 
+	// [신규] 스킬 패턴 상대좌표(X = 전방, Y = 우측)를 바라보는 방향 기준 그리드 오프셋으로 회전
+	static FIntPoint RotatePatternOffset(const FIntPoint& PatternPoint, EGridDirection Facing);
+
+	// [신규] 좌표/방향/행동 예약이 바뀐 직후 호출 (위협 맵 등 증분 갱신용)
+	virtual void OnGridStateChanged() {}
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status")
 	bool bDead = false;
 
@@ -261,6 +289,9 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Grid")
 	int32 GetGridIndex() const;
 
+	// [신규] 실제로 보드 위에 올라가 있는지 (풀에서 대기 중인 적은 false)
+	virtual bool IsOnBoard() const { return true; }
+
 	// 하이라이트(윤곽선) 켜기/끄기 함수
 	virtual void SetHighlight(bool bEnable);
 
@@ -270,6 +301,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Attributes")
 	void ApplyDamage(float Damage);
 
+	// [신규] 일괄 판정용: 체력만 깎고 이벤트는 보내지 않음 (FDamageBatch가 이후 BroadcastHealthChanged 1회)
+	// Instigator는 이벤트 버스 Damage의 Source (모르면 nullptr)
+	void ApplyDamageDeferred(float Damage, AActor* Instigator = nullptr);
+
+	// [신규] 현재 체력으로 NotifyHealthChanged (HP바 / 피격 / 사망 처리)
+	void BroadcastHealthChanged();
+
+	// 체력 변경 알림 단일 진입점: HandleHealthChanged -> 이벤트 버스 HealthChanged -> OnHealthChanged(BP)
+	void NotifyHealthChanged(int32 CurrentHP, int32 MaxHP);
+
+	int32 GetCurrentHP() const;
+
 	/** BP에서 사망 처리를 위한 이벤트 */
 	UFUNCTION(BlueprintImplementableEvent, Category = "Status")
 	void OnDeath();
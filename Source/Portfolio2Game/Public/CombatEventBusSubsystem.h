@@ -0,0 +1,115 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatEventBusSubsystem.generated.h"
+
+// 전투 이벤트 종류
+UENUM(BlueprintType)
+enum class ECombatEventType : uint8
+{
+	Damage,			// Target이 Value만큼 피해 (Source는 알 수 없으면 None)
+	Death,			// Source 사망
+	Move,			// Source가 Cell로 이동 확정
+	Rotate,			// Source 회전 확정 (Value = EGridDirection)
+	Reserve,		// 적 Source가 Payload 스킬 예약
+	Fire,			// Source가 Payload 스킬 발동
+	RoundStart,		// Value = 라운드 번호
+	TurnStart,		// Value = 턴 번호, Source = 플레이어 턴이면 플레이어 / 적 턴이면 None
+	HealthChanged,	// Source 체력 변경 (Value = 현재 체력, SubValue = 최대 체력)
+
+	Count UMETA(Hidden)
+};
+
+// 전투 이벤트 1건 (값 타입, 필드 의미는 ECombatEventType 참고)
+USTRUCT(BlueprintType)
+struct PORTFOLIO2GAME_API FCombatEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Event")
+	ECombatEventType Type = ECombatEventType::Damage;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Event")
+	TObjectPtr<AActor> Source = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Event")
+	TObjectPtr<AActor> Target = nullptr;
+
+	// 스킬 데이터 등 부가 정보
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Event")
+	TObjectPtr<UObject> Payload = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Event")
+	FIntPoint Cell = FIntPoint::ZeroValue;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Event")
+	int32 Value = 0;
+
+	// Value와 짝을 이루는 보조 값 (HealthChanged = 최대 체력)
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Event")
+	int32 SubValue = 0;
+
+	// 발생 시점의 전투 턴 (마지막 TurnStart 기준)
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Event")
+	int32 Turn = 0;
+
+	// 발생 프레임 (GFrameCounter 하위 32비트)
+	UPROPERTY(BlueprintReadOnly, Category = "Combat|Event")
+	int32 Frame = 0;
+};
+
+// 네이티브 구독자용 (발행 즉시 호출, 리플렉션 없음)
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCombatEventNative, const FCombatEvent&);
+
+// BP/UMG 구독자용 (프레임당 1회, 그 프레임 이벤트 전체를 발생 순서대로)
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCombatEventBatch, const TArray<FCombatEvent>&, Events);
+
+/**
+ * [신규] 전투 이벤트 버스 (월드 서브시스템)
+ * - 게임 코드는 Publish 한 곳으로 이벤트를 보내고, 로그/텔레메트리/리플레이/UI가 같은 흐름을 구독
+ * - 네이티브 구독자는 OnEvent(Type) / OnAnyEvent()에 AddUObject 등으로 등록 → 즉시 호출
+ * - BP 구독자가 있을 때만 이벤트를 모아 두었다가 프레임 끝(서브시스템 Tick)에 OnCombatEventBatch 한 번 방송
+ * - Battle.Events.Log 1 : 모든 이벤트를 LogBattle에 출력
+ */
+UCLASS()
+class PORTFOLIO2GAME_API UCombatEventBusSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// 월드의 버스 (월드가 없으면 nullptr)
+	static UCombatEventBusSubsystem* Get(const UObject* WorldContextObject);
+
+	// 월드에서 버스를 찾아 발행 (월드가 없으면 무시)
+	static void Publish(const UObject* WorldContextObject, ECombatEventType Type, AActor* Source,
+		AActor* Target = nullptr, FIntPoint Cell = FIntPoint::ZeroValue, int32 Value = 0, UObject* Payload = nullptr);
+
+	void Publish(const FCombatEvent& Event);
+
+	FOnCombatEventNative& OnEvent(ECombatEventType Type) { return TypeListeners[(int32)Type]; }
+	FOnCombatEventNative& OnAnyEvent() { return AnyListeners; }
+
+	UPROPERTY(BlueprintAssignable, Category = "Combat|Event")
+	FOnCombatEventBatch OnCombatEventBatch;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	virtual void Deinitialize() override;
+
+private:
+	FOnCombatEventNative TypeListeners[(int32)ECombatEventType::Count];
+	FOnCombatEventNative AnyListeners;
+
+	// 이번 프레임 BP 배치 (방송 중 발행된 이벤트는 다음 배치로)
+	UPROPERTY(Transient)
+	TArray<FCombatEvent> PendingBatch;
+
+	UPROPERTY(Transient)
+	TArray<FCombatEvent> DispatchBatch;
+
+	int32 CurrentTurn = 0;
+};
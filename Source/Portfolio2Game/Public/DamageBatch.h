@@ -0,0 +1,32 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+class ACharacterBase;
+class AActor;
+
+// [신규] 스킬 1회 시전의 데미지 묶음
+// - 패턴 루프에서는 Add로 모으기만 하고 (체력/이벤트/사망 처리 없음)
+// - Resolve에서 유닛별 합산 데미지를 한 번에 적용한 뒤, 유닛당 체력 이벤트 1회
+// - 생존자 이벤트를 먼저 보내고 사망자는 마지막에 처리 (판정 결과가 패턴 순회 순서와 무관)
+struct PORTFOLIO2GAME_API FDamageBatch
+{
+	struct FEntry
+	{
+		ACharacterBase* Target = nullptr;
+		AActor* Instigator = nullptr;	// 데미지 이벤트의 Source
+		float Damage = 0.0f;
+		int32 Hits = 0;
+	};
+
+	// 같은 유닛 + 같은 시전자면 합산
+	void Add(ACharacterBase* Target, float Damage, AActor* Instigator);
+
+	void Resolve();
+
+	bool IsEmpty() const { return Entries.Num() == 0; }
+	const TArray<FEntry, TInlineAllocator<8>>& GetEntries() const { return Entries; }
+
+private:
+	TArray<FEntry, TInlineAllocator<8>> Entries;
+};
@@ -5,6 +5,7 @@
 #include "SkillBase.h"
 #include "EnemyAIStructs.h"
 #include "Components/WidgetComponent.h"
+#include "MontageSectionCache.h"
 #include "EnemyCharacter.generated.h"
 
 class APlayerCharacter;
@@ -94,6 +95,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Anim")
     void PlayChargeMontageIfReady();
 
+    // [신규] 몽타주 섹션 캐시 (BeginPlay에서 한 번 생성)
+    const FMontageSectionCache& GetStateSections() const { return StateSections; }
+    const FMontageSectionCache& GetAttackSections(const UAnimMontage* Montage) const { return (Montage == Montage_Atk_B) ? AtkSections_B : AtkSections_A; }
+
+protected:
+    FMontageSectionCache StateSections;
+    FMontageSectionCache AtkSections_A;
+    FMontageSectionCache AtkSections_B;
+
+public:
+
 
     // ───────── 행동 함수 ─────────
     // [신규] 1단계: 행동 결정 (플레이어 턴 시작 시 호출) -> PendingAction 저장
@@ -137,8 +149,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI")
     bool ExecuteSkill(USkillBase* SkillToUse);
 
-    UFUNCTION()
-    void HandleHealthChanged(int32 NewHP, int32 NewMaxHP);
+    virtual void HandleHealthChanged(int32 NewHP, int32 NewMaxHP) override;
 
     void Die();
 
@@ -151,6 +162,40 @@ public:
     // [신규] 맵 이동 등으로 액터가 파괴될 때 타이머를 끄기 위한 오버라이드
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+public:
+    // ───────── 풀링 ─────────
+
+    // [신규] 풀에서 대기 중인지 (예열 스폰 시 FinishSpawning 전에 BattleManager가 true로 설정)
+    bool bInPool = false;
+
+    virtual bool IsOnBoard() const override { return !bInPool; }
+
+    // [신규] 풀에서 꺼낼 때 호출: GAS/몽타주/AI/충돌/하이라이트를 초기화하고 지정 칸에 배치
+    void ActivateFromPool(FIntPoint Coord, int32 Index);
+
+    // [신규] 풀로 돌려보낼 때 호출: 숨기고 충돌/틱/타이머/몽타주 정지, GAS 상태 초기화
+    void DeactivateForPool();
+
+protected:
+    // 난이도에 따른 최대 체력 보정 (BeginPlay / 풀 반납 시 속성 초기화 직후 적용)
+    void ApplyDifficultyScaling();
+
+    // 풀 재사용용 GAS 초기화: 활성 GE 전부 제거, 루즈 태그 제거, 속성을 기본값 + 초기 스탯 GE(+난이도 보정)로
+    void ResetAbilitySystemForPool();
+
+    // 속성 세트의 모든 속성 Base 값 (GetAttributesFromSetClass 순서)
+    void GetAttributeBaseValues(TArray<float>& OutValues) const;
+
+    // 최초 스폰 직후 속성 값 (풀 재사용 후 같은 스탯으로 돌아왔는지 검사용)
+    TArray<float> SpawnAttributeBases;
+
+    // 등장 모션 (Spawn 몽타주 또는 State 몽타주의 Default 섹션)
+    void PlaySpawnAnimation();
+
+    // 사망 시 꺼둔 충돌을 되돌리기 위한 원래 설정값
+    ECollisionEnabled::Type DefaultCapsuleCollision = ECollisionEnabled::QueryOnly;
+    ECollisionEnabled::Type DefaultMeshCollision = ECollisionEnabled::NoCollision;
+
 public:
     // ───────── UI / 순서 표시 ─────────
 
@@ -184,6 +229,9 @@ public:
     // CharacterBase의 함수 오버라이드
     virtual void SetHighlight(bool bEnable) override;
 
+    // 위치/방향/예약 변경 시 BattleManager의 위협 맵에 이 적만 다시 반영
+    virtual void OnGridStateChanged() override;
+
 protected:
     // 위젯에 스킬 정보를 채워넣으라고 BP에 요청하는 이벤트
     UFUNCTION(BlueprintImplementableEvent, Category = "UI")
@@ -63,7 +63,7 @@ public:
 
 	// ───────── 기능 ─────────
 
-	/** BattleManager가 적 리스트를 던져주면, 분석해서 UI로 방송함 */
+	/** BattleManager가 생존 적 리스트를 던져주면, 분석해서 UI로 방송함 */
 	UFUNCTION(BlueprintCallable, Category = "Order")
 	void UpdateActionQueue(const TArray<AEnemyCharacter*>& Enemies);
 
@@ -76,6 +76,10 @@ public:
 	FOnUpdateActionQueue OnUpdateActionQueue;
 
 private:
+	// 마지막으로 방송한 큐 (용량과 칸별 이름 문자열을 다음 갱신에 재사용)
+	UPROPERTY(Transient)
+	TArray<FEnemyActionIconInfo> QueueData;
+
 	// 내부 계산용: 상대 방향 -> 월드 방향 변환
 	EGridDirection CalculateWorldDirection(EGridDirection Facing, EGridDirection RelativeMove);
 };
\ No newline at end of file
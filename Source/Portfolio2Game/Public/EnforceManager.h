@@ -93,14 +93,17 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Setup")
 	TObjectPtr<class ACameraActor> StageCamera;
 
-	// [신규] 연출 위젯 임시 저장
-	UPROPERTY()
-	UUserWidget* CurrentTransitionWidget;
-
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UI")
 	TSubclassOf<UUserWidget> TopBarWidgetClass;
 
+	// [신규] 전투 레벨 안에서 오버레이로 실행 중인지 (BattleManager가 스폰 직전에 설정)
+	// 플레이어/카메라/상단 바/전환 연출은 전투 레벨 것을 그대로 쓰고 HUD만 올림
+	UPROPERTY(BlueprintReadOnly, Category = "Setup")
+	bool bOverlayMode = false;
+
 private:
+	void BeginOverlay(); // 오버레이 모드 시작 (스폰/카메라/전환 연출 생략)
+	void CreateHUD(); // 강화 HUD 생성
 	void SpawnPlayerAndInit(); // 플레이어 소환 및 초기화
 	void CompleteStage(); // 저장 및 이동 시작
 	void MoveToNextLevel(); // 실제 이동
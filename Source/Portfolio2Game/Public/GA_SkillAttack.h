@@ -30,6 +30,9 @@ protected:
 	UFUNCTION()
 	void OnMontageEnded();
 
+	// 즉시 판정 모드: 판정과 무관하게 몽타주만 재생 (노티파이 대기 없음)
+	void PlayMontageVisualOnly(ACharacterBase* Caster, UAnimMontage* MontageToPlay, FName StartSectionName);
+
 private:
 	// 실행 중인 스킬 정보 임시 저장
 	UPROPERTY()
@@ -0,0 +1,60 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+// 그리드 형태 스냅샷 (인터페이스 BlueprintNativeEvent를 매번 부르지 않기 위한 네이티브 캐시)
+// - 그리드 액터가 바뀔 때(연결/이동/설정 변경)만 Build로 다시 만듦
+// - 인덱스 규칙은 AGridISM과 동일한 Column-Major (Index = X * Height + Y)
+struct PORTFOLIO2GAME_API FGridGeometry
+{
+	int32 Width = 0;
+	int32 Height = 0;
+	double CellSizeX = 0.0;
+	double CellSizeY = 0.0;
+	FVector LocalOffset = FVector::ZeroVector;
+	FTransform GridTransform = FTransform::Identity;
+
+	// 칸별 월드 좌표 (Index 순서)
+	TArray<FVector> CellWorldPositions;
+
+	// GridActor에서 값을 한 번씩만 읽어 스냅샷 생성 (IGridDataInterface 미구현이면 비워둠)
+	void Build(const AActor* GridActor);
+	void Reset() { *this = FGridGeometry(); }
+
+	bool IsValid() const { return Width > 0 && Height > 0; }
+	int32 Num() const { return Width * Height; }
+
+	bool IsValidCoord(FIntPoint Coord) const
+	{
+		return Coord.X >= 0 && Coord.X < Width && Coord.Y >= 0 && Coord.Y < Height;
+	}
+
+	bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < Num(); }
+
+	// 범위 검사 없음 (기존 GetGridIndexFromCoord와 동일한 계산)
+	int32 CoordToIndex(FIntPoint Coord) const
+	{
+		return Height > 0 ? (Coord.X * Height) + Coord.Y : INDEX_NONE;
+	}
+
+	FIntPoint IndexToCoord(int32 Index) const
+	{
+		return Height > 0 ? FIntPoint(Index / Height, Index % Height) : FIntPoint(-1, -1);
+	}
+
+	// 그리드 로컬 좌표 (오프셋 미포함)
+	FVector CoordToLocal(FIntPoint Coord) const
+	{
+		return FVector(Coord.X * CellSizeX, Coord.Y * CellSizeY, 0.0);
+	}
+
+	// 보드 안이면 테이블 조회, 밖이면(스킬 이펙트 등) 캐시된 값으로 직접 계산
+	FVector CoordToWorld(FIntPoint Coord) const
+	{
+		if (IsValidCoord(Coord))
+		{
+			return CellWorldPositions[CoordToIndex(Coord)];
+		}
+		return GridTransform.TransformPosition(CoordToLocal(Coord) + LocalOffset);
+	}
+};
@@ -10,6 +10,21 @@
 
 class ABattleManager;
 class ACharacterBase;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+// [신규] 타일 상태 = 인스턴스 커스텀 데이터 슬롯 번호 (머티리얼 PerInstanceCustomData[n]으로 읽음)
+UENUM(BlueprintType)
+enum class EGridTileState : uint8
+{
+	Hover,			// 마우스 오버
+	MoveRange,		// 이동 가능 범위
+	AttackPreview,	// 스킬 범위 미리보기
+	Threat,			// 적 공격 예고 범위
+	Selected,		// 선택된 칸
+
+	Count UMETA(Hidden)
+};
 
 UCLASS()
 class PORTFOLIO2GAME_API AGridISM : public AActor, public IGridDataInterface, public IMouseOverGridInterface
@@ -79,6 +94,41 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|UI")
 	FVector HPBarAdditionalOffset = FVector::ZeroVector;
 
+	// ───────── 타일 (네이티브 ISM) ─────────
+	// 보드 전체 타일을 인스턴스 하나로 그림 (드로우콜 1회)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid|Tiles")
+	TObjectPtr<UInstancedStaticMeshComponent> TileInstances;
+
+	// 비워두면 네이티브 타일을 만들지 않음 (기존 BP 타일 유지)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Tiles")
+	TObjectPtr<UStaticMesh> TileMesh;
+
+	// 타일 메시 스케일 (기본 100x100 평면 기준)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Tiles")
+	FVector TileScale = FVector(0.95f, 0.95f, 1.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Tiles")
+	float TileZOffset = 0.0f;
+
+	// 타일 인스턴스 재생성 (OnConstruction에서 자동 호출, 인스턴스 번호 = 그리드 인덱스)
+	void BuildTiles();
+
+	// 한 칸 상태 변경
+	UFUNCTION(BlueprintCallable, Category = "Grid|Tiles")
+	void SetTileState(int32 Index, EGridTileState State, bool bEnabled);
+
+	// 여러 칸 상태를 한 번에 변경 (렌더 상태 갱신 1회)
+	// bExclusive = true면 목록 밖 칸의 같은 상태는 끔 (범위 미리보기 교체용)
+	UFUNCTION(BlueprintCallable, Category = "Grid|Tiles")
+	void SetTileStates(const TArray<int32>& Indices, EGridTileState State, bool bEnabled = true, bool bExclusive = false);
+
+	// 보드 전체에서 해당 상태 끄기
+	UFUNCTION(BlueprintCallable, Category = "Grid|Tiles")
+	void ClearTileState(EGridTileState State);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Grid|Tiles")
+	bool GetTileState(int32 Index, EGridTileState State) const;
+
 	// ───────── 기능 ─────────
 	UFUNCTION(BlueprintCallable, Category = "Grid|UI")
 	void UpdateTileHPBar(int32 Index, bool bShow, int32 CurrentHP = 0, int32 MaxHP = 0);
@@ -93,6 +143,7 @@ public:
 	virtual double  GetGridSizeX_Implementation() const override { return GridSizeX; }
 	virtual double  GetGridSizeY_Implementation() const override { return GridSizeY; }
 	virtual FVector GetGridLocationOffset_Implementation() const override { return GridLocationOffset; }
+	virtual UInstancedStaticMeshComponent* GetGridInstanceComponent_Implementation() const override { return TileInstances; }
 	virtual FIntPoint GetGridCoordFromIndex_Implementation(int32 Index) override;
 	virtual int32     GetGridIndexFromCoord_Implementation(FIntPoint Coord) override;
 
@@ -116,4 +167,13 @@ private:
 	UPROPERTY()
 	TObjectPtr<ABattleManager> CachedBattleManager;
 
+	// [신규] 타일 상태 비트 (칸별 EGridTileState 비트마스크, 중복 갱신 방지)
+	TArray<uint8> TileStateBits;
+
+	// 마우스 오버 중인 타일 인덱스
+	int32 HoveredTileIndex = INDEX_NONE;
+
+	// 상태 비트 + 커스텀 데이터 갱신 (렌더 상태는 호출자가 한 번에 갱신)
+	bool WriteTileState(int32 Index, EGridTileState State, bool bEnabled);
+
 };
\ No newline at end of file
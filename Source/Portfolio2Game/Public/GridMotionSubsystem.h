@@ -0,0 +1,48 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GridMotionSubsystem.generated.h"
+
+class ACharacterBase;
+
+// [신규] 그리드 유닛의 이동 연출을 한 곳에서 일괄 진행하는 월드 서브시스템
+// - 유닛 액터 Tick은 기본 꺼짐, 이동 중인 유닛만 여기 목록에 들어감
+// - 목록이 비어 있으면 서브시스템 자체도 틱하지 않음
+UCLASS()
+class PORTFOLIO2GAME_API UGridMotionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// 이동 등록 (이미 이동 중이면 현재 위치에서 새 목표로 다시 시작)
+	void StartMove(ACharacterBase* Character, const FVector& From, const FVector& To, float Duration);
+
+	// 도착 처리 없이 이동만 취소 (풀 반납 등)
+	void CancelMove(ACharacterBase* Character);
+
+	// 진행 중인 이동을 전부 목표 위치로 확정하고 도착 처리 (연출 건너뛰기)
+	void FinishAllMoves();
+
+	bool IsMoving(const ACharacterBase* Character) const;
+	int32 GetNumActiveMoves() const { return Units.Num(); }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	virtual void Deinitialize() override;
+
+private:
+	// 이동 중인 유닛 (병렬 배열, 같은 인덱스가 한 유닛)
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ACharacterBase>> Units;
+
+	TArray<FVector> Starts;
+	TArray<FVector> Dests;
+	TArray<float> Elapsed;
+	TArray<float> Durations;
+
+	void RemoveMoveAt(int32 Index);
+};
@@ -0,0 +1,83 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+// 지연을 추적할 플레이어 명령 종류
+enum class EInputLatencyCommand : uint8
+{
+	Move,		// 이동 (GA_Move)
+	Rotate,		// 회전 (Q/E/R)
+	Skill,		// 스킬 큐 실행 (GA_SkillAttack)
+
+	Count
+};
+
+// 입력 → 화면 반영까지의 구간 (입력 시각 기준 누적 ms)
+enum class EInputLatencyStage : uint8
+{
+	Input,			// Enhanced Input 핸들러 진입
+	Activate,		// GAS 어빌리티 활성화 (회전은 없음)
+	Commit,			// 논리 상태 확정 (MoveToCell / RequestRotation / 스킬 판정 시퀀스 시작)
+	VisualStart,	// 연출 시작 (StartVisualMove / 회전·스킬 몽타주 재생)
+	FirstMotion,	// 첫 화면 변화 (이동 보간 첫 프레임 / 첫 회전 적용 / 스킬 Hit 판정)
+	FrameEnd,		// FirstMotion 프레임의 게임 스레드 종료
+	Rendered,		// 같은 프레임의 렌더 스레드 처리 완료
+
+	Count
+};
+
+// 입력이 눌린 시각 (0이면 Begin 시각 사용)
+// 턴 전에 버퍼된 명령은 bBuffered: 누른 시각 ~ 실행(Begin)까지는 QueueWait로 따로 기록
+struct FInputLatencyStamp
+{
+	uint64 Cycles = 0;
+	uint64 Frame = 0;
+	bool bBuffered = false;
+};
+
+/**
+ * 플레이어 입력 → 화면 반영 지연 추적기 (Shipping 제외)
+ * - 플레이어 명령은 한 번에 하나씩만 진행되므로 열린 추적은 1개, 새 명령이 들어오면 미완료 추적은 버림
+ * - 시작 시각은 Input_* 핸들러에서 찍은 Stamp. 턴 전에 버퍼된 명령은 턴 시작 실행 시각부터 재고,
+ *   버퍼 대기 시간은 QueueWait로 따로 집계 (입력 → 반응 수치에 턴 대기가 섞이지 않게)
+ * - 각 단계는 처음 도달한 시각만 기록, FirstMotion 이후 프레임 종료/렌더 완료 시각을 받아 샘플 확정
+ * - Battle.InputLatency.Enable : 추적 켜기/끄기 (기본 꺼짐)
+ * - Battle.InputLatency.Dump : 명령 종류별 단계 p50/p90/p99 출력
+ * - Battle.InputLatency.ExportCSV [경로] : 같은 내용을 CSV로 저장 (기본 Saved/Profiling)
+ * - Battle.InputLatency.Reset : 기록 초기화
+ */
+#if UE_BUILD_SHIPPING
+class FInputLatencyTracer
+{
+public:
+	static bool IsEnabled() { return false; }
+	static FInputLatencyStamp Stamp() { return FInputLatencyStamp(); }
+	static void Begin(EInputLatencyCommand Command, const FInputLatencyStamp& InputStamp = FInputLatencyStamp()) {}
+	static void Mark(EInputLatencyStage Stage) {}
+	static void Dump(FOutputDevice& Ar) {}
+	static bool ExportCSV(const FString& FilePath) { return false; }
+	static void Reset() {}
+};
+#else
+class PORTFOLIO2GAME_API FInputLatencyTracer
+{
+public:
+	static bool IsEnabled();
+
+	// 입력 핸들러 진입 시각 (추적이 꺼져 있으면 빈 값)
+	static FInputLatencyStamp Stamp();
+
+	// 명령 실행 시 호출: 새 추적 시작 (InputStamp 시각을 Input 단계로, 비어 있거나 버퍼된 명령이면 지금)
+	static void Begin(EInputLatencyCommand Command, const FInputLatencyStamp& InputStamp = FInputLatencyStamp());
+
+	// 열린 추적이 있으면 해당 단계 시각 기록 (이미 기록된 단계는 무시)
+	static void Mark(EInputLatencyStage Stage);
+
+	static void Dump(FOutputDevice& Ar);
+	static bool ExportCSV(const FString& FilePath);
+	static void Reset();
+
+	static const TCHAR* GetCommandName(EInputLatencyCommand Command);
+	static const TCHAR* GetStageName(EInputLatencyStage Stage);
+};
+#endif
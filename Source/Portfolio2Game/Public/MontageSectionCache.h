@@ -0,0 +1,40 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+class UAnimMontage;
+
+// 코드에서 점프하는 몽타주 섹션 (이름은 애님 에셋 섹션 이름과 동일해야 함)
+enum class EMontageSection : uint8
+{
+	Default,		// 스폰/기본 자세
+	Ready,			// 공격 준비 (이후 Ready_Stay 루프)
+	AttackStart,	// 준비 루프를 끊고 공격 시작
+	Hit,			// 피격
+	Death,			// 사망
+
+	Count
+};
+
+// 섹션 FName (한 번만 만들어 재사용, 호출마다 FName 테이블 조회 없음)
+PORTFOLIO2GAME_API const FName& GetMontageSectionName(EMontageSection Section);
+
+// [신규] 몽타주 하나의 섹션 인덱스/길이 캐시 (로드 후 BeginPlay에서 한 번 Build)
+struct PORTFOLIO2GAME_API FMontageSectionCache
+{
+	void Build(const UAnimMontage* InMontage);
+
+	// Build 이후 몽타주가 바뀌었으면 다시 만듦
+	void EnsureBuilt(const UAnimMontage* InMontage);
+
+	bool HasSection(EMontageSection Section) const { return Indices[(int32)Section] != INDEX_NONE; }
+	int32 GetIndex(EMontageSection Section) const { return Indices[(int32)Section]; }
+
+	// 섹션이 없으면 0
+	float GetLength(EMontageSection Section) const { return Lengths[(int32)Section]; }
+
+private:
+	const UAnimMontage* Montage = nullptr;
+	int32 Indices[(int32)EMontageSection::Count] = { INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+	float Lengths[(int32)EMontageSection::Count] = {};
+};
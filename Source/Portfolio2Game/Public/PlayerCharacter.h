@@ -5,6 +5,9 @@
 #include "CoreMinimal.h"
 #include "CharacterBase.h"
 #include "PlayerSkillData.h"
+#include "SkillQueuePreview.h"
+#include "MontageSectionCache.h"
+#include "PlayerInputRouter.h"
 #include "PlayerCharacter.generated.h"
 
 // Enhanced Input 헤더
@@ -28,6 +31,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSkillDataUpdated, int32, SkillInd
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNewSkillAcquired, int32, NewSkillIndex);
 
+/** 스킬 큐 미리보기(타격 칸/예상 데미지/처치)가 갱신될 때 UI에 알리기 위한 델리게이트 */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSkillQueuePreviewUpdated, const FSkillQueuePreview&, Preview);
+
 /** GAS 입력 바인딩용 Enum */
 namespace PlayerAbilityInputID
 {
@@ -57,6 +63,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turn System")
 	float InputCooldown = 0.3f; // 0.3초 쿨타임
 
+	// [신규] 턴 시작 전 이 시간(초) 안에 누른 이동/회전은 보관했다가 턴 시작 시 실행
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turn System")
+	float InputBufferWindow = 0.5f;
+
 	/** 스킬이 큐에 추가될 때 BP에서 바인딩할 이벤트 */
 	UPROPERTY(BlueprintAssignable, Category = "UI|Event")
 	FOnSkillSelected_BP OnSkillSelected_BPEvent;
@@ -83,6 +93,9 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Anim")
     TObjectPtr<UAnimMontage> StateMontage;
 
+	// [신규] StateMontage 섹션 캐시
+	FMontageSectionCache StateSections;
+
 
 	// 모든 쿨타임 감소
 	UFUNCTION(BlueprintCallable)
@@ -100,11 +113,20 @@ public:
 	TObjectPtr<UStaticMeshComponent> WeaponMesh;
 
 private:
-	bool bInputLocked = false;  // 입력 잠금 여부
-	FTimerHandle InputLockTimerHandle;
+	// 턴 게이트 / 입력 쿨타임 / 명령 버퍼
+	FPlayerInputRouter InputRouter;
 
 	void SetInputEnabled(bool bEnabled);
 
+	bool IsInputLocked() const;
+
+	// 지금 바로 이동/회전을 받을 수 있는가 (내 턴 + 쿨타임 아님 + 이번 턴 미행동)
+	bool CanAcceptCommand() const;
+
+	// 입력 -> (내 턴이면) 실행 / (아니면) 버퍼
+	void RouteCommand(EPlayerCommand Command);
+	void ExecuteCommand(EPlayerCommand Command, const FInputLatencyStamp& InputStamp);
+
 
 protected:
 	// ❌ (제거) BeginPlay() (부모 클래스(CharacterBase)가 BattleManager를 찾음)
@@ -199,6 +221,24 @@ protected:
 	// 대기열 비워졌는지 확인
 	bool HasQueuedSkill() const { return SkillQueueIndices.Num() > 0; }
 
+	// [신규] 쿨타임/스킬 큐를 HUD 뷰모델에 반영 (값이 그대로면 알림 없음)
+	void SyncHUDSkillState();
+
+	// ───────── 스킬 큐 미리보기 ─────────
+	// 현재 큐를 보드 복사본에 판정한 결과 (큐 추가/취소/회전 시 갱신)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|Preview")
+	FSkillQueuePreview SkillQueuePreview;
+
+	UPROPERTY(BlueprintAssignable, Category = "UI|Event")
+	FOnSkillQueuePreviewUpdated OnSkillQueuePreviewUpdated;
+
+	// 미리보기 재계산 + 방송
+	UFUNCTION(BlueprintCallable, Category = "Skill|Preview")
+	void RefreshSkillQueuePreview();
+
+	// 큐가 있는 상태에서 회전/이동하면 미리보기 갱신
+	virtual void OnGridStateChanged() override;
+
 private:
 	// 입력 래퍼 함수 (기존과 동일)
 	void Input_MoveUp();
@@ -206,7 +246,6 @@ private:
 	void Input_MoveLeft();
 	void Input_MoveRight();
 	void LockInputTemporarily();
-	void UnlockInput();
 
 	/** (신규) 0.2초 딜레이 실행을 위한 타이머 핸들 */
 	FTimerHandle SkillQueueTimerHandle;
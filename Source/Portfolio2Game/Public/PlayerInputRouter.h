@@ -0,0 +1,49 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "InputLatencyTracer.h"
+
+// 턴 게이트를 거치는 플레이어 명령 (이동/회전)
+enum class EPlayerCommand : uint8
+{
+	None,
+	MoveUp,
+	MoveDown,
+	MoveLeft,
+	MoveRight,
+	RotateCCW,
+	RotateCW,
+	Rotate180,
+};
+
+// [신규] 플레이어 입력 게이트 + 명령 버퍼
+// - 매핑 컨텍스트는 빙의 시 한 번만 추가하고 계속 유지, 턴 게이트는 여기서 bool 검사로 처리
+// - 입력 쿨타임은 타이머 대신 해제 시각(타임스탬프) 비교
+// - 턴이 오기 직전에 누른 명령 1개를 보관했다가 턴 시작 시 바로 실행
+struct PORTFOLIO2GAME_API FPlayerInputRouter
+{
+	// 턴 게이트 (StartAction / EndAction)
+	void Open() { bOpen = true; }
+	void Close() { bOpen = false; }
+	bool IsOpen() const { return bOpen; }
+
+	// 입력 쿨타임
+	void Lock(double Now, float Duration) { UnlockTime = Now + Duration; }
+	bool IsLocked(double Now) const { return Now < UnlockTime; }
+
+	// 마지막 명령만 보관 (새 입력이 이전 입력을 덮어씀). InputStamp는 지연 추적용 누른 시각
+	void Buffer(EPlayerCommand Command, double Now, const FInputLatencyStamp& InputStamp);
+
+	// 보관 후 Window 초 이내의 명령만 꺼냄 (오래된 입력은 버림), 누른 시각은 OutInputStamp로
+	EPlayerCommand ConsumeBuffered(double Now, float Window, FInputLatencyStamp& OutInputStamp);
+
+	void Reset();
+
+private:
+	bool bOpen = false;
+	double UnlockTime = 0.0;
+
+	EPlayerCommand BufferedCommand = EPlayerCommand::None;
+	double BufferedTime = 0.0;
+	FInputLatencyStamp BufferedStamp;
+};
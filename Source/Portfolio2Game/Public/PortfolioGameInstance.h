@@ -5,8 +5,11 @@
 #include "PlayerSkillData.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "SkillBase.h"
+#include "BattleGCSubsystem.h"
 #include "PortfolioGameInstance.generated.h"
 
+class UBattleHUDViewModel;
+
 UCLASS()
 class PORTFOLIO2GAME_API UPortfolioGameInstance : public UGameInstance
 {
@@ -61,6 +64,39 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GameFlow")
 	int32 DifficultyLevel = 1;
 
+	// [신규] StageList 중 강화 단계 이름 (여기 있는 단계는 맵을 열지 않고 직전 전투 레벨에서 오버레이로 진행)
+	// 비워 두면 기존처럼 강화 맵을 OpenLevel
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameFlow")
+	TArray<FName> OverlayEnforceStages;
+
+
+	// ───────── 게임 옵션 (신규) ─────────
+
+	// 즉시 판정 모드: 턴 로직이 몽타주 길이/노티파이를 기다리지 않고 바로 진행 (연출은 압축 재생)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Options")
+	bool bInstantResolve = false;
+
+	// 즉시 판정 모드에서 캐릭터 연출(애니메이션/이동) 배속
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Options", meta = (ClampMin = "1.0"))
+	float InstantVisualTimeDilation = 3.0f;
+
+	// 옵션 변경 + 현재 레벨 캐릭터 연출 배속 즉시 반영
+	UFUNCTION(BlueprintCallable, Category = "Options")
+	void SetInstantResolve(bool bEnable);
+
+	// 즉시 판정 모드에서 뒤따라오는 연출 건너뛰기 (이동은 도착 확정, 즉시 판정 중 시작한 몽타주만 끝으로)
+	// 일반 모드에서는 로직이 몽타주 노티파이/종료를 기다리므로 무시
+	UFUNCTION(BlueprintCallable, Category = "Options")
+	void SkipPendingVisuals();
+
+	static bool IsInstantResolve(const UObject* WorldContextObject);
+
+	// 턴 진행 대기 시간 (즉시 판정 모드면 다음 프레임)
+	static float GetTurnStepDelay(const UObject* WorldContextObject, float NormalDelay);
+
+	// 캐릭터에 적용할 연출 배속 (일반 모드 1.0)
+	float GetVisualTimeDilation() const { return bInstantResolve ? InstantVisualTimeDilation : 1.0f; }
+
 
 	// ───────── 함수 ─────────
 
@@ -74,19 +110,55 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GameFlow")
 	FName GetNextStageName();
 
+	// [신규] 다음 스테이지 이름만 확인 (인덱스/난이도 변화 없음)
+	UFUNCTION(BlueprintPure, Category = "GameFlow")
+	FName PeekNextStageName() const;
+
+	// [신규] 맵을 열지 않고 오버레이로 진행할 강화 단계인지
+	UFUNCTION(BlueprintPure, Category = "GameFlow")
+	bool IsOverlayEnforceStage(FName StageName) const { return !StageName.IsNone() && OverlayEnforceStages.Contains(StageName); }
+
+	// [신규] 다음에 열 맵 패키지를 미리 비동기 로드 (OpenLevel 시 디스크 로드 생략, 맵 로드 완료 시 해제)
+	UFUNCTION(BlueprintCallable, Category = "GameFlow")
+	void PreloadStageMap(FName MapName);
+
+	virtual void LoadComplete(const float LoadTime, const FString& MapName) override;
+
 	// ★ [신규] 게임 완전 초기화 (새 게임 시작 시 호출)
 	UFUNCTION(BlueprintCallable, Category = "GameFlow")
 	void ResetGameData();
 
-	// ★ [신규] 현재 맵 이름 반환 (UI 표시용)
+	// ★ [신규] 현재 맵 이름 반환 (UI 표시용, HUD는 뷰모델의 StageDisplayName 사용)
 	UFUNCTION(BlueprintCallable, Category = "UI")
 	FString GetCurrentStageDisplayName();
 
+	// [신규] 전투 HUD 뷰모델 (Init에서 생성, 게임 내내 유지)
+	UFUNCTION(BlueprintPure, Category = "UI")
+	UBattleHUDViewModel* GetBattleHUDViewModel() const { return HUDViewModel; }
+
 	// (내부용) 매 프레임 시간 측정 함수
 	bool TickPlayTime(float DeltaTime);
 
+	// [신규] 전투 GC 통계 (월드마다 새로 생기는 UBattleGCSubsystem이 여기에 누적)
+	FBattleGCStats& GetBattleGCStats() { return BattleGCStats; }
+
 
 	// 특정 경로에 있는 모든 스킬 데이터를 로드하고 정렬해서 반환
 	UFUNCTION(BlueprintCallable, Category = "Game Data")
 	TArray<USkillBase*> LoadAllSkillsFromPath(FName Path = "/Game/TeamShare/TeamShare_JSH/Data/SkillData/DA");
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UBattleHUDViewModel> HUDViewModel;
+
+	// 스테이지 인덱스가 바뀐 뒤 뷰모델에 이름 반영
+	void PushStageToHUD();
+
+	// 미리 로드한 다음 맵 (OpenLevel 전에 GC되지 않도록 보관)
+	UPROPERTY(Transient)
+	TObjectPtr<UPackage> PreloadedMapPackage;
+
+	FName PreloadedMapName;
+
+	FBattleGCStats BattleGCStats;
 };
\ No newline at end of file
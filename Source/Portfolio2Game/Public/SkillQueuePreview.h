@@ -0,0 +1,62 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "SkillQueuePreview.generated.h"
+
+class APlayerCharacter;
+class AEnemyCharacter;
+
+// 스킬 큐 미리보기: 적 1명이 받는 결과
+USTRUCT(BlueprintType)
+struct PORTFOLIO2GAME_API FSkillPreviewTarget
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Skill|Preview")
+	TObjectPtr<AEnemyCharacter> Enemy = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Skill|Preview")
+	FIntPoint Coord = FIntPoint::ZeroValue;
+
+	// 큐 전체에서 실제로 깎이는 HP (초과 데미지 제외)
+	UPROPERTY(BlueprintReadOnly, Category = "Skill|Preview")
+	int32 Damage = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Skill|Preview")
+	int32 HPBefore = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Skill|Preview")
+	int32 HPAfter = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Skill|Preview")
+	bool bKilled = false;
+
+	// 몇 번째 큐 슬롯(0~2)에서 처치되는지 (생존 시 -1)
+	UPROPERTY(BlueprintReadOnly, Category = "Skill|Preview")
+	int32 KilledBySlot = INDEX_NONE;
+};
+
+// 스킬 큐 미리보기: 현재 SkillQueueIndices를 순서대로 판정한 결과
+USTRUCT(BlueprintType)
+struct PORTFOLIO2GAME_API FSkillQueuePreview
+{
+	GENERATED_BODY()
+
+	// 보드 안에서 타격되는 칸 (중복 제거, 판정 순서)
+	UPROPERTY(BlueprintReadOnly, Category = "Skill|Preview")
+	TArray<FIntPoint> AffectedCells;
+
+	// 피해를 받는 적 (BattleManager::Enemies 순서)
+	UPROPERTY(BlueprintReadOnly, Category = "Skill|Preview")
+	TArray<FSkillPreviewTarget> Targets;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Skill|Preview")
+	int32 TotalDamage = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Skill|Preview")
+	int32 PredictedKills = 0;
+
+	// 보드(적 위치/HP)를 가볍게 복사해 큐를 판정 (GAS/몽타주/이펙트 없음)
+	// GA_SkillAttack::ApplySkillEffects와 같은 규칙: 시전자 칸 제외, 죽은 적은 이후 스킬에 안 맞음
+	static FSkillQueuePreview Build(const APlayerCharacter* Player);
+};
@@ -5,15 +5,161 @@
 #include "EnemyCharacter.h"
 #include "StageData.generated.h"
 
+// 스폰 칸 결정 방식
+UENUM(BlueprintType)
+enum class ESpawnCellRule : uint8
+{
+	RandomDefault,	// BattleManager의 EnemySpawnIndices 중 빈 칸에서 랜덤 (기존 방식)
+	RandomFromList,	// SpawnCells 중 빈 칸에서 랜덤
+	Fixed			// SpawnCells[i]에 i번째 적 배치 (막혀 있으면 기본 후보에서 랜덤)
+};
+
+// 라운드 진행/증원 조건
+UENUM(BlueprintType)
+enum class ERoundTriggerType : uint8
+{
+	AllKilled,			// 보드 위 적 전멸 (플레이어 턴 시작 시 판정)
+	KillCount,			// 이번 라운드에서 Value마리 처치
+	TurnCount,			// 이번 라운드 시작 후 Value턴 경과
+	SingleEnemyTimer	// 적이 1마리만 남은 채로 Value턴 경과 (적 턴 종료 시 판정)
+};
+
+USTRUCT(BlueprintType)
+struct FRoundTrigger
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	ERoundTriggerType Type = ERoundTriggerType::AllKilled;
+
+	// KillCount / TurnCount / SingleEnemyTimer 에서 사용하는 기준값
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = "1", EditCondition = "Type != ERoundTriggerType::AllKilled"))
+	int32 Value = 1;
+};
+
+// 라운드 도중 추가로 나오는 증원
+USTRUCT(BlueprintType)
+struct FReinforcementWave
+{
+	GENERATED_BODY()
+
+	// 증원 조건 (라운드당 한 번만 발동)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	FRoundTrigger Trigger;
+
+	// 소프트 참조: 스테이지가 선택되어 로드될 때만 적 클래스를 불러옴
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TArray<TSoftClassPtr<AEnemyCharacter>> EnemiesToSpawn;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	ESpawnCellRule SpawnRule = ESpawnCellRule::RandomDefault;
+
+	// 스폰 칸 인덱스 (세로 우선) - RandomFromList / Fixed 에서 사용
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TArray<int32> SpawnCells;
+};
+
 // 하나의 라운드 정보 (이번 라운드에 나올 적들)
 USTRUCT(BlueprintType)
 struct FRoundDef
 {
 	GENERATED_BODY()
 
-	// 이번 라운드에 소환할 적 종류 리스트
+	// 이번 라운드에 소환할 적 종류 리스트 (소프트 참조, 스테이지 로드 시 비동기 로드)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TArray<TSoftClassPtr<AEnemyCharacter>> EnemiesToSpawn;
+
+	// [신규] 스폰 칸 결정 방식
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
-	TArray<TSubclassOf<AEnemyCharacter>> EnemiesToSpawn;
+	ESpawnCellRule SpawnRule = ESpawnCellRule::RandomDefault;
+
+	// [신규] 스폰 칸 인덱스 (세로 우선) - RandomFromList / Fixed 에서 사용
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TArray<int32> SpawnCells;
+
+	// [신규] 다음 라운드로 넘어가는 조건 (하나라도 만족하면 진행)
+	// 비워두면 기존 규칙: 전멸 또는 1마리 남은 채 2턴 경과
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TArray<FRoundTrigger> AdvanceTriggers;
+
+	// [신규] 라운드 도중 증원
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TArray<FReinforcementWave> Reinforcements;
+};
+
+// ───────── 컴파일된 런타임 플랜 ─────────
+// 저장(쿡) 시점에 Rounds를 평탄화해 둔 결과. 런타임은 이것만 읽음.
+
+USTRUCT()
+struct FCompiledSpawnGroup
+{
+	GENERATED_BODY()
+
+	// 런타임에는 GetRequiredEnemyClasses로 모아 로드한 뒤 Get()으로 사용
+	UPROPERTY()
+	TArray<TSoftClassPtr<AEnemyCharacter>> Classes;
+
+	UPROPERTY()
+	TArray<int32> Cells;
+
+	UPROPERTY()
+	ESpawnCellRule Rule = ESpawnCellRule::RandomDefault;
+};
+
+USTRUCT()
+struct FCompiledWave
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FRoundTrigger Trigger;
+
+	// FStageRuntimePlan::Groups 인덱스
+	UPROPERTY()
+	int32 GroupIndex = INDEX_NONE;
+};
+
+USTRUCT()
+struct FCompiledRound
+{
+	GENERATED_BODY()
+
+	// FStageRuntimePlan::Groups 인덱스
+	UPROPERTY()
+	int32 GroupIndex = INDEX_NONE;
+
+	// 기본값이 채워진 진행 조건
+	UPROPERTY()
+	TArray<FRoundTrigger> AdvanceTriggers;
+
+	UPROPERTY()
+	TArray<FCompiledWave> Waves;
+};
+
+USTRUCT()
+struct FStageRuntimePlan
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FCompiledRound> Rounds;
+
+	UPROPERTY()
+	TArray<FCompiledSpawnGroup> Groups;
+
+	// 라운드 + 증원 전체 적 수 (남은 적 UI 초기값, 실제 등장 수는 BattleManager가 런타임에 보정)
+	UPROPERTY()
+	int32 TotalEnemies = 0;
+
+	// Rounds를 평탄화한 원본의 해시 (에디터 변경 감지용, 저장/쿡 시점에만 계산)
+	UPROPERTY()
+	uint32 SourceHash = 0;
+
+	// 플랜 구조 버전 (컴파일 방식이 바뀌면 올림, 다르면 원본이 같아도 다시 컴파일)
+	UPROPERTY()
+	int32 PlanVersion = 0;
+
+	bool IsEmpty() const { return Rounds.Num() == 0; }
 };
 
 // 스테이지 정보 (라운드들의 모음)
@@ -26,4 +172,33 @@ public:
 	// 이 스테이지의 라운드 구성 (인덱스 0 = 1라운드, 1 = 2라운드...)
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stage")
 	TArray<FRoundDef> Rounds;
-};
\ No newline at end of file
+
+	// [신규] 이 스테이지를 배치할 그리드의 칸 수 (검증용: 범위 밖 스폰 칸 검사, 0이면 생략)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stage|Validation", meta = (ClampMin = "0"))
+	int32 GridCellCount = 0;
+
+	// 런타임용 플랜 (PreSave에서 갱신, 런타임 PostLoad는 버전이 다를 때만 다시 만듦)
+	const FStageRuntimePlan& GetRuntimePlan() const { return CompiledPlan; }
+
+	// Rounds -> CompiledPlan 재생성
+	void CompilePlan();
+
+	// [신규] 이 스테이지가 쓰는 적 클래스 경로 (중복 제거, 비동기 로드 요청용)
+	void GetRequiredEnemyClasses(TArray<FSoftObjectPath>& OutPaths) const;
+
+	virtual void PostLoad() override;
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
+#endif
+
+protected:
+	UPROPERTY()
+	FStageRuntimePlan CompiledPlan;
+
+#if WITH_EDITOR
+	uint32 ComputeSourceHash() const;
+#endif
+};
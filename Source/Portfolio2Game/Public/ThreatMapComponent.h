@@ -0,0 +1,73 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "ThreatMapComponent.generated.h"
+
+class ABattleManager;
+class AEnemyCharacter;
+
+// 위협 맵이 바뀌었을 때 (UI 갱신용)
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnThreatMapChanged);
+
+// [신규] 다음 적 턴에 발사될 예약 스킬의 칸별 위협 정보
+// - 적의 위치/방향/예약이 바뀔 때(OnGridStateChanged) 그 적 하나만 다시 계산
+// - 칸별 데미지 합계와 공격자 목록을 유지하고, 그리드 타일 Threat 상태를 함께 갱신
+UCLASS(ClassGroup = (Battle), meta = (BlueprintSpawnableComponent))
+class PORTFOLIO2GAME_API UThreatMapComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UThreatMapComponent();
+
+	// 적 하나의 기여분을 빼고 현재 상태로 다시 더함 (발사 예정이 아니면 빼기만)
+	void UpdateEnemy(AEnemyCharacter* Enemy);
+
+	// 전체 초기화 (전투 시작 / 그리드 변경)
+	void ResetThreats();
+
+	// ───────── 조회 (C++ / UMG) ─────────
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Threat")
+	float GetThreatDamageAt(FIntPoint Coord) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Threat")
+	bool IsCellThreatened(FIntPoint Coord) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Threat")
+	TArray<AEnemyCharacter*> GetAttackersAt(FIntPoint Coord) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Threat")
+	TArray<FIntPoint> GetThreatenedCells() const;
+
+	UPROPERTY(BlueprintAssignable, Category = "Threat")
+	FOnThreatMapChanged OnThreatMapChanged;
+
+	// 그리드 타일의 Threat 상태(AGridISM 커스텀 데이터)를 함께 갱신할지
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Threat")
+	bool bDriveTileOverlay = true;
+
+private:
+	// 적 하나가 차지한 칸과 데미지 (빼기용으로 보관)
+	struct FEnemyThreat
+	{
+		TArray<int32, TInlineAllocator<16>> Cells;
+		float Damage = 0.0f;
+	};
+
+	ABattleManager* GetBattleManager() const;
+
+	// 그리드 크기에 맞춰 칸 버퍼 준비 (그리드가 없으면 false)
+	bool EnsureCellBuffers();
+
+	void RemoveContribution(AEnemyCharacter* Enemy, const FEnemyThreat& Threat);
+	void PushTileOverlay(const TArray<int32, TInlineAllocator<32>>& TouchedCells);
+
+	TArray<float> CellDamage;
+	TArray<TArray<TWeakObjectPtr<AEnemyCharacter>, TInlineAllocator<2>>> CellAttackers;
+	TMap<TObjectKey<AEnemyCharacter>, FEnemyThreat> EnemyThreats;
+
+	// PushTileOverlay 전용 재사용 버퍼
+	TArray<int32> ScratchOnCells;
+	TArray<int32> ScratchOffCells;
+};